@@ -83,6 +83,9 @@ testNewAPI(Buffer auto &buffer, const std::size_t vector_length, const std::size
                     }
                     nSamplesProduced += vector_length;
                 }
+                if constexpr (requires { writer.flush(); }) {
+                    writer.flush(); // batched multi-producer: release the unused rest of the writer's claimed block
+                }
                 barrier.arrive_and_wait();
             }
         });
@@ -128,10 +131,11 @@ testNewAPI(Buffer auto &buffer, const std::size_t vector_length, const std::size
 
 inline const boost::ut::suite _buffer_tests = [] {
     const std::size_t samples = 10'000'000; // minimum number of samples
-    enum class BufferStrategy { posix, portable };
+    // posix: double-mapped, portable: mirror copy of each sample, portable_split: wrap-aware two-span access w/o mirror copy
+    enum class BufferStrategy { posix, portable, portable_split };
 
     for (WriteApi writerAPI : { WriteApi::via_lambda, WriteApi::via_split_request_publish_RAII }) {
-        for (BufferStrategy strategy : { /*BufferStrategy::posix,*/ BufferStrategy::portable }) {
+        for (BufferStrategy strategy : { BufferStrategy::posix, BufferStrategy::portable, BufferStrategy::portable_split }) {
             for (std::size_t veclen : { 1UL, 1024UL }) {
                 if (not(strategy == BufferStrategy::posix and veclen == 1UL)) {
                     benchmark::results::add_separator();
@@ -141,22 +145,24 @@ inline const boost::ut::suite _buffer_tests = [] {
                         const std::size_t size      = std::max(4096UL, veclen) * nR * 10UL;
                         auto              allocator = std::pmr::polymorphic_allocator<int32_t>();
                         const bool        is_posix  = strategy == BufferStrategy::posix;
+                        const WrapMode    wrap_mode = strategy == BufferStrategy::portable_split ? WrapMode::Split : WrapMode::Mirrored;
+                        const std::string name      = is_posix ? "POSIX" : (wrap_mode == WrapMode::Split ? "split" : "portable");
                         auto              invoke    = [&](auto buffer) {
                             switch (writerAPI) {
                             case WriteApi::via_split_request_publish_RAII:
-                                testNewAPI<WriteApi::via_split_request_publish_RAII>(buffer, veclen, samples, nP, nR, is_posix ? "POSIX - RAII writer" : "portable - RAII writer");
+                                testNewAPI<WriteApi::via_split_request_publish_RAII>(buffer, veclen, samples, nP, nR, fmt::format("{} - RAII writer", name));
                                 break;
                             case WriteApi::via_lambda:
-                            default: testNewAPI<WriteApi::via_lambda>(buffer, veclen, samples, nP, nR, is_posix ? "POSIX" : "portable"); break;
+                            default: testNewAPI<WriteApi::via_lambda>(buffer, veclen, samples, nP, nR, name); break;
                             }
                         };
                         if (nP == 1) {
                             using BufferType   = circular_buffer<int32_t, std::dynamic_extent, ProducerType::Single>;
-                            Buffer auto buffer = is_posix ? BufferType(size) : BufferType(size, allocator);
+                            Buffer auto buffer = is_posix ? BufferType(size) : BufferType(size, allocator, wrap_mode);
                             invoke(buffer);
                         } else {
                             using BufferType   = circular_buffer<int32_t, std::dynamic_extent, ProducerType::Multi>;
-                            Buffer auto buffer = is_posix ? BufferType(size) : BufferType(size, allocator);
+                            Buffer auto buffer = is_posix ? BufferType(size) : BufferType(size, allocator, wrap_mode);
                             invoke(buffer);
                         }
                     }
@@ -166,6 +172,175 @@ inline const boost::ut::suite _buffer_tests = [] {
     }
 };
 
+inline const boost::ut::suite _buffer_allocation_tests = [] {
+    using namespace boost::ut;
+    constexpr std::size_t n_buffers = 1'000; // e.g. number of ports in a large graph
+
+    benchmark::results::add_separator();
+    for (std::size_t size : { 4096UL, 65536UL }) {
+        // N.B. buffers are created and destroyed in the same iteration, i.e. the caching resource serves all but the first allocation
+        auto *plain   = double_mapped_memory_resource::defaultAllocator();
+        auto  caching = caching_double_mapped_memory_resource();
+        ::benchmark::benchmark<10>(fmt::format("create {} buffers of {:>5} samples - double-mapped", n_buffers, size), n_buffers) = [&] {
+            for (std::size_t i = 0; i < n_buffers; ++i) {
+                circular_buffer<int32_t> buffer(size, std::pmr::polymorphic_allocator<int32_t>(plain));
+            }
+        };
+        ::benchmark::benchmark<10>(fmt::format("create {} buffers of {:>5} samples - caching", n_buffers, size), n_buffers) = [&] {
+            for (std::size_t i = 0; i < n_buffers; ++i) {
+                circular_buffer<int32_t> buffer(size, std::pmr::polymorphic_allocator<int32_t>(&caching));
+            }
+        };
+        const auto stats = caching.statistics();
+        expect(eq(stats.misses, 1UL)) << fmt::format("hits: {} misses: {}", stats.hits, stats.misses);
+    }
+};
+
+inline const boost::ut::suite _reader_sweep_tests = [] {
+    constexpr std::size_t n_samples = 1'000'000;
+    constexpr std::size_t veclen    = 64;
+
+    benchmark::results::add_separator();
+    for (std::size_t nReaders : { 1UL, 2UL, 4UL, 8UL, 16UL, 32UL, 64UL }) {
+        // legacy registry: one heap-allocated and cache-line-padded Sequence per reader
+        std::vector<std::shared_ptr<Sequence>> sequences;
+        SequenceTable                          table;
+        std::vector<SequenceTable::Slot>       slots;
+        Sequence                               cursor(0);
+        for (std::size_t i = 0; i < nReaders; i++) {
+            sequences.emplace_back(std::make_shared<Sequence>(0));
+            slots.emplace_back(table.add(cursor));
+        }
+        ::benchmark::benchmark<10>(fmt::format("getMinimumSequence - {:>2} readers - vector<shared_ptr<Sequence>>", nReaders), n_samples) = [&] {
+            for (std::size_t i = 0; i < n_samples; i++) {
+                ::benchmark::force_store(detail::getMinimumSequence(sequences));
+            }
+        };
+        ::benchmark::benchmark<10>(fmt::format("getMinimumSequence - {:>2} readers - SequenceTable", nReaders), n_samples) = [&] {
+            for (std::size_t i = 0; i < n_samples; i++) {
+                ::benchmark::force_store(detail::getMinimumSequence(table));
+            }
+        };
+
+        // single-threaded publish -> consume round-trip, dominated by the writer's gating-sequence scan
+        circular_buffer<int32_t> buffer(4096);
+        BufferWriter auto        writer = buffer.new_writer();
+        std::vector<decltype(buffer.new_reader())> readers;
+        for (std::size_t i = 0; i < nReaders; i++) {
+            readers.emplace_back(buffer.new_reader());
+        }
+        ::benchmark::benchmark<10>(fmt::format("publish/consume - {:>2} readers", nReaders), n_samples) = [&] {
+            for (std::size_t i = 0; i < n_samples; i += veclen) {
+                writer.publish([](std::span<int32_t> &) {}, veclen);
+                for (auto &reader : readers) {
+                    std::ignore = reader.consume(veclen);
+                }
+            }
+        };
+    }
+};
+
+inline const boost::ut::suite _wait_strategy_tests = [] {
+    constexpr std::size_t n_samples = 1'000'000;
+    constexpr std::size_t veclen    = 16;
+
+    // publish cost of the blocking strategies while nobody waits: BlockingWaitStrategy locks a mutex on every publish
+    benchmark::results::add_separator();
+    auto run = [&]<WaitStrategy Strategy>(std::string_view name) {
+        circular_buffer<int32_t, std::dynamic_extent, ProducerType::Single, Strategy> buffer(4096);
+        BufferWriter auto                                                            writer = buffer.new_writer();
+        BufferReader auto                                                            reader = buffer.new_reader();
+        ::benchmark::benchmark<10>(fmt::format("publish/consume w/o waiters - {}", name), n_samples) = [&] {
+            for (std::size_t i = 0; i < n_samples; i += veclen) {
+                writer.publish([](std::span<int32_t> &) {}, veclen);
+                std::ignore = reader.consume(veclen);
+            }
+        };
+    };
+    run.operator()<SleepingWaitStrategy>("SleepingWaitStrategy (non-blocking reference)");
+    run.operator()<BlockingWaitStrategy>("BlockingWaitStrategy");
+    run.operator()<FutexWaitStrategy<>>("FutexWaitStrategy");
+    run.operator()<EventFdWaitStrategy>("EventFdWaitStrategy");
+    run.operator()<AdaptiveWaitStrategy>("AdaptiveWaitStrategy");
+};
+
+inline const boost::ut::suite _multi_producer_tests = [] {
+    constexpr std::size_t n_samples = 10'000'000;
+
+    // publication-state scan of a fully published buffer with 1M slots -- word-wise (64 slots per step)
+    benchmark::results::add_separator();
+    {
+        constexpr std::size_t                     size = 1UL << 20;
+        Sequence                                  cursor;
+        NoWaitStrategy                            waitStrategy;
+        SequenceTable                             dependents;
+        MultiThreadedStrategy<size, NoWaitStrategy> strategy(cursor, waitStrategy);
+        const auto                                sequence = strategy.next(dependents, size);
+        strategy.publish(sequence, size);
+        ::benchmark::benchmark<10>("getHighestPublishedSequence - 1M published slots", size) = [&] { ::benchmark::force_store(strategy.getHighestPublishedSequence(0, sequence)); };
+    }
+
+    // multi-writer throughput: one CAS on the shared cursor per claim vs. per block of claims (batched)
+    for (std::size_t veclen : { 1UL, 64UL }) {
+        benchmark::results::add_separator();
+        for (std::size_t nP : { 2UL, 4UL, 8UL, 16UL }) {
+            circular_buffer<int32_t, std::dynamic_extent, ProducerType::Multi> buffer(65536);
+            testNewAPI<WriteApi::via_lambda>(buffer, veclen, n_samples, nP, 1, "multi-producer");
+        }
+        for (std::size_t nP : { 2UL, 4UL, 8UL, 16UL }) {
+            circular_buffer<int32_t, std::dynamic_extent, ProducerType::MultiBatched> buffer(65536);
+            testNewAPI<WriteApi::via_lambda>(buffer, veclen, n_samples, nP, 1, "batched");
+        }
+    }
+};
+
+inline const boost::ut::suite _full_buffer_tests = [] {
+    using namespace boost::ut;
+    constexpr std::size_t n_attempts = 1'000'000;
+    constexpr std::size_t veclen     = 16;
+
+    // failing publish attempts of a source under back-pressure, i.e. the reader does not consume
+    benchmark::results::add_separator();
+    auto run = [&]<ProducerType producerType>(std::string_view name) {
+        circular_buffer<int32_t, std::dynamic_extent, producerType> buffer(4096);
+        BufferWriter auto                                          writer = buffer.new_writer();
+        BufferReader auto                                          reader = buffer.new_reader();
+        expect(writer.try_publish([](std::span<int32_t> &) {}, buffer.size()));
+        expect(eq(reader.available(), buffer.size()));
+
+        // reference: previous claim API signalling a full buffer by throwing (and catching) an exception
+        struct no_capacity_exception : std::runtime_error {
+            no_capacity_exception() : std::runtime_error("no_capacity_exception") {}
+        };
+        std::size_t n_failed = 0;
+        ::benchmark::benchmark<10>(fmt::format("full buffer - {} - exception (reference)", name), n_attempts) = [&] {
+            for (std::size_t i = 0; i < n_attempts; i++) {
+                try {
+                    if (!writer.try_publish([](std::span<int32_t> &) {}, veclen)) {
+                        throw no_capacity_exception();
+                    }
+                } catch (const no_capacity_exception &) {
+                    n_failed++;
+                }
+            }
+        };
+        ::benchmark::benchmark<10>(fmt::format("full buffer - {} - try_publish", name), n_attempts) = [&] {
+            for (std::size_t i = 0; i < n_attempts; i++) {
+                n_failed += writer.try_publish([](std::span<int32_t> &) {}, veclen) ? 0 : 1;
+            }
+        };
+        ::benchmark::benchmark<10>(fmt::format("full buffer - {} - try_reserve_output_range", name), n_attempts) = [&] {
+            for (std::size_t i = 0; i < n_attempts; i++) {
+                auto range = writer.try_reserve_output_range(veclen);
+                n_failed += range.empty() ? 1 : 0;
+            }
+        };
+        expect(eq(n_failed, 3 * 10 * n_attempts));
+    };
+    run.operator()<ProducerType::Single>("single producer");
+    run.operator()<ProducerType::Multi>("multi producer ");
+};
+
 int
 main() { /* not needed by the UT framework */
 }
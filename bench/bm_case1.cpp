@@ -728,6 +728,40 @@ inline const boost::ut::suite _sample_by_sample_vs_bulk_access_tests = [] {
     templated_cascaded_test_bulk(static_cast<int>(2.0), "runtime   src->mult(2.0)->div(2.0)->add(-1)->sink - int bulk");
 };
 
+inline const boost::ut::suite _simd_alignment_tests = [] {
+    using namespace boost::ut;
+    using namespace benchmark;
+
+    // chunk sizes of the leading copy node: multiples of the SIMD width keep the streams vector-aligned (empty prologue),
+    // odd chunk sizes shift the sample positions and exercise the masked prologue/epilogue of the SIMD loops
+    // N.B. complex samples are not vectorisable and take the scalar path (reference)
+    constexpr auto templated_alignment_test = []<typename T, std::size_t chunk_size>(T factor, const char *test_name) {
+        fg::graph flow_graph;
+        auto     &src   = flow_graph.make_node<test::source<T>>(N_SAMPLES);
+        auto     &cpy   = flow_graph.make_node<copy<T, 0, chunk_size>>();
+        auto     &mult1 = flow_graph.make_node<multiply<T>>(factor);
+        auto     &div1  = flow_graph.make_node<divide<T>>(factor);
+        auto     &mult2 = flow_graph.make_node<multiply<T>>(factor);
+        auto     &sink  = flow_graph.make_node<test::sink<T>>();
+
+        expect(eq(fg::connection_result_t::SUCCESS, flow_graph.connect<"out">(src).template to<"in">(cpy)));
+        expect(eq(fg::connection_result_t::SUCCESS, flow_graph.connect<"out">(cpy).template to<"in">(mult1)));
+        expect(eq(fg::connection_result_t::SUCCESS, flow_graph.connect<"out">(mult1).template to<"in">(div1)));
+        expect(eq(fg::connection_result_t::SUCCESS, flow_graph.connect<"out">(div1).template to<"in">(mult2)));
+        expect(eq(fg::connection_result_t::SUCCESS, flow_graph.connect<"out">(mult2).template to<"in">(sink)));
+
+        fg::scheduler::simple sched{ std::move(flow_graph) };
+
+        ::benchmark::benchmark<1LU>{ test_name }.repeat<N_ITER>(N_SAMPLES) = [&sched]() { invoke_work(sched); };
+    };
+    templated_alignment_test.template operator()<float, 1024>(2.0f, "runtime   src->copy(N≤1024)->mult->div->mult->sink - float aligned");
+    templated_alignment_test.template operator()<float, 1001>(2.0f, "runtime   src->copy(N≤1001)->mult->div->mult->sink - float misaligned");
+    templated_alignment_test.template operator()<double, 1024>(2.0, "runtime   src->copy(N≤1024)->mult->div->mult->sink - double aligned");
+    templated_alignment_test.template operator()<double, 1001>(2.0, "runtime   src->copy(N≤1001)->mult->div->mult->sink - double misaligned");
+    templated_alignment_test.template operator()<std::complex<float>, 1024>({ 2.0f, 0.0f }, "runtime   src->copy(N≤1024)->mult->div->mult->sink - complex<float> aligned");
+    templated_alignment_test.template operator()<std::complex<float>, 1001>({ 2.0f, 0.0f }, "runtime   src->copy(N≤1001)->mult->div->mult->sink - complex<float> misaligned");
+};
+
 int
 main() { /* not needed by the UT framework */
 }
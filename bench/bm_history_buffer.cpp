@@ -3,6 +3,7 @@
 #include <boost/ut.hpp>
 #include <chrono>
 #include <iostream>
+#include <numeric>
 #include <thread>
 
 #include <fmt/format.h>
@@ -143,6 +144,60 @@ inline const boost::ut::suite _buffer_tests = [] {
             }
         };
     }
+
+    for (const std::size_t chunk_size : { 8UL, 256UL }) {
+        history_buffer<int> buffer(1024);
+        std::vector<int>    chunk(chunk_size);
+        std::iota(chunk.begin(), chunk.end(), 0);
+
+        ::benchmark::benchmark<n_repetitions>(fmt::format("history_buffer<int>(1024) - push_back loop, chunk {:3}", chunk_size), samples) = [&buffer, &chunk] {
+            for (std::size_t i = 0; i < samples; i += chunk.size()) {
+                for (const int value : chunk) {
+                    buffer.push_back(value);
+                }
+            }
+            ::benchmark::force_store(buffer[0]);
+        };
+
+        ::benchmark::benchmark<n_repetitions>(fmt::format("history_buffer<int>(1024) - push_back_bulk, chunk {:3}", chunk_size), samples) = [&buffer, &chunk] {
+            for (std::size_t i = 0; i < samples; i += chunk.size()) {
+                buffer.push_back_bulk(chunk);
+            }
+            ::benchmark::force_store(buffer[0]);
+        };
+    }
+    {
+        constexpr std::size_t n_taps = 32;
+        history_buffer<float> buffer(n_taps);
+        std::vector<float>    taps(n_taps, 1.f / n_taps);
+
+        "history_buffer<float>(32) - FIR via rbegin()"_benchmark.repeat<n_repetitions>(samples) = [&buffer, &taps] {
+            float sum = 0.f;
+            for (std::size_t i = 0; i < samples; i++) {
+                buffer.push_back(static_cast<float>(i));
+                sum += std::inner_product(taps.begin(), taps.end(), buffer.rbegin(), 0.f);
+            }
+            ::benchmark::force_store(sum);
+        };
+
+        // contiguous oldest->newest history allows explicit SIMD with the taps stored in reversed (oldest-first) order
+        namespace stdx = vir::stdx;
+        using V        = stdx::native_simd<float>;
+        const std::vector<float> taps_reversed(taps.rbegin(), taps.rend());
+        "history_buffer<float>(32) - FIR via get_span() + SIMD"_benchmark.repeat<n_repetitions>(samples) = [&buffer, &taps_reversed] {
+            float sum = 0.f;
+            for (std::size_t i = 0; i < samples; i++) {
+                buffer.push_back(static_cast<float>(i));
+                const auto history = buffer.get_span(0, taps_reversed.size());
+                V          acc     = 0.f;
+                for (std::size_t j = 0; j < history.size(); j += V::size()) {
+                    acc += V(&history[j], stdx::element_aligned) * V(&taps_reversed[j], stdx::element_aligned);
+                }
+                sum += stdx::reduce(acc);
+            }
+            ::benchmark::force_store(sum);
+        };
+    }
 };
 
 int
@@ -0,0 +1,157 @@
+#include "benchmark.hpp"
+
+#include <boost/ut.hpp>
+#include <graph.hpp>
+#include <node.hpp>
+#include <settings.hpp>
+
+namespace fg = fair::graph;
+
+inline constexpr std::size_t N_ITER    = 10;
+inline constexpr std::size_t N_UPDATES = 100'000;
+
+/**
+ * node with a typical number of settings: the lookup cost grows with the number of reflected members
+ */
+template<typename T>
+struct many_settings : public fg::node<many_settings<T>> {
+    fg::IN<T>          in;
+    fg::OUT<T>         out;
+    T                  scaling_factor = T(1);
+    T                  offset         = T(0);
+    float              sample_rate    = 1000.f;
+    float              gain_min       = -1.f;
+    float              gain_max       = +1.f;
+    std::int32_t       n_taps         = 64;
+    std::int32_t       decimation     = 1;
+    std::string        signal_name    = "signal";
+    std::string        signal_unit    = "V";
+    std::string        trigger_name   = "trigger";
+    std::vector<float> window{ 1.f, 1.f, 1.f };
+    bool               enabled = true;
+
+    template<fair::meta::t_or_simd<T> V>
+    [[nodiscard]] constexpr V
+    process_one(const V &a) const noexcept {
+        return a * scaling_factor + offset;
+    }
+};
+
+ENABLE_REFLECTION_FOR_TEMPLATE_FULL((typename T), (many_settings<T>), in, out, scaling_factor, offset, sample_rate, gain_min, gain_max, n_taps, decimation, signal_name, signal_unit,
+                                    trigger_name, window, enabled);
+
+/**
+ * reference: the previous key lookup iterating over all reflected members and constructing a 'std::string' per member and key
+ */
+template<typename Node>
+void
+reflection_auto_update(Node &node, const fg::property_map &parameters, fg::property_map &staged) {
+    for (const auto &[localKey, localValue] : parameters) {
+        const auto &key   = localKey;
+        const auto &value = localValue;
+        for_each(refl::reflect(node).members, [&](auto member) {
+            using Type = fg::unwrap_if_wrapped_t<std::remove_cvref_t<decltype(member(node))>>;
+            if constexpr (is_writable(member) && (std::is_arithmetic_v<Type> || std::is_same_v<Type, std::string> || fair::meta::vector_type<Type>) ) {
+                if (std::string(get_display_name(member)) == key && std::holds_alternative<Type>(value)) {
+                    staged.insert_or_assign(key, value);
+                }
+            }
+        });
+    }
+}
+
+[[maybe_unused]] inline const boost::ut::suite _settings_benchmarks = [] {
+    using namespace boost::ut;
+    using namespace benchmark;
+
+    // typical tag: one matching setting, two keys that are not settings of this node
+    const fg::property_map tag{ { "sample_rate", 48'000.f }, fg::tag::TRIGGER_TIME(uint64_t{ 42 }), { "tag_counter", uint64_t{ 1 } } };
+
+    fg::graph flow_graph;
+    auto     &node = flow_graph.make_node<many_settings<float>>();
+    {
+        fg::property_map staged;
+        "reflection loop  - auto_update(tag)"_benchmark.repeat<N_ITER>(N_UPDATES) = [&] {
+            for (std::size_t i = 0; i < N_UPDATES; i++) {
+                reflection_auto_update(node, tag, staged);
+            }
+            force_store(staged);
+        };
+    }
+    "dispatch table   - auto_update(tag)"_benchmark.repeat<N_ITER>(N_UPDATES) = [&] {
+        for (std::size_t i = 0; i < N_UPDATES; i++) {
+            node.settings().auto_update(tag);
+        }
+        expect(node.settings().changed());
+    };
+    "dispatch table   - auto_update(tag) + apply_staged_parameters()"_benchmark.repeat<N_ITER>(N_UPDATES) = [&] {
+        for (std::size_t i = 0; i < N_UPDATES; i++) {
+            node.settings().auto_update(tag);
+            force_store(node.settings().apply_staged_parameters());
+        }
+        expect(eq(node.sample_rate, 48'000.f));
+    };
+    // apply cost of a single assigned key, incl. refreshing the active settings from all readable fields via the dispatch table
+    const fg::property_map single_key{ { "gain_max", 2.f } };
+    "dispatch table   - set(single key) + apply_staged_parameters()"_benchmark.repeat<N_ITER>(N_UPDATES) = [&] {
+        for (std::size_t i = 0; i < N_UPDATES; i++) {
+            force_store(node.settings().set(single_key));
+            force_store(node.settings().apply_staged_parameters());
+        }
+        expect(eq(node.gain_max, 2.f));
+    };
+    "dispatch table   - set(tag)"_benchmark.repeat<N_ITER>(N_UPDATES) = [&] {
+        for (std::size_t i = 0; i < N_UPDATES; i++) {
+            force_store(node.settings().set(tag));
+        }
+    };
+
+    // multiplexed operation: cycling through 30 (beam) contexts, each defining a full set of settings
+    constexpr std::size_t         n_contexts = 30;
+    std::vector<fg::property_map> context_tags;
+    std::vector<fg::property_map> full_settings;
+    for (std::size_t i = 0; i < n_contexts; i++) {
+        const auto             value = static_cast<float>(i);
+        const fg::property_map settings{ { "scaling_factor", value }, { "offset", -value }, { "sample_rate", 1000.f * value }, { "gain_min", -value }, { "gain_max", value },
+                                         { "n_taps", static_cast<std::int32_t>(i) }, { "signal_name", fmt::format("beam {}", i) } };
+        context_tags.push_back({ fg::tag::CONTEXT(fmt::format("BEAM{}", i)) });
+        full_settings.push_back(settings);
+        expect(node.settings().set(settings, fg::SettingsCtx{ .context = context_tags.back() }).empty());
+    }
+    "context switch   - re-staging full settings per switch"_benchmark.repeat<N_ITER>(N_UPDATES) = [&] {
+        for (std::size_t i = 0; i < N_UPDATES; i++) {
+            node.settings().auto_update(full_settings[i % n_contexts]);
+            force_store(node.settings().apply_staged_parameters());
+        }
+    };
+    // cost breakdown of a context switch: the lock-free lookup of the stored settings, their assignment, the (pointer-only) update of the active settings and
+    // -- here without an 'init(..)' callback, i.e. no staged map -- the forward map of the auto-forwarded keys ('sample_rate' and 'signal_name')
+    "context switch   - tag::CONTEXT lookup only (auto_update)"_benchmark.repeat<N_ITER>(N_UPDATES) = [&] {
+        for (std::size_t i = 0; i < N_UPDATES; i++) {
+            node.settings().auto_update(context_tags[i % n_contexts]);
+        }
+        force_store(node.settings().apply_staged_parameters());
+    };
+    {
+        const auto auto_forward = node.settings().auto_forward_parameters();
+        node.settings().auto_forward_parameters().clear();
+        "context switch   - tag::CONTEXT w/o auto-forwarded keys"_benchmark.repeat<N_ITER>(N_UPDATES) = [&] {
+            for (std::size_t i = 0; i < N_UPDATES; i++) {
+                node.settings().auto_update(context_tags[i % n_contexts]);
+                force_store(node.settings().apply_staged_parameters());
+            }
+        };
+        node.settings().auto_forward_parameters() = auto_forward;
+    }
+    "context switch   - tag::CONTEXT with stored context settings"_benchmark.repeat<N_ITER>(N_UPDATES) = [&] {
+        for (std::size_t i = 0; i < N_UPDATES; i++) {
+            node.settings().auto_update(context_tags[i % n_contexts]);
+            force_store(node.settings().apply_staged_parameters());
+        }
+        expect(eq(node.scaling_factor, static_cast<float>((N_UPDATES - 1) % n_contexts)));
+    };
+};
+
+int
+main() { /* not needed by the UT framework */
+}
@@ -0,0 +1,147 @@
+#include "benchmark.hpp"
+
+#include <boost/ut.hpp>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <shared_circular_buffer.hpp>
+
+#ifdef HAS_SHARED_MEMORY_INTERFACE
+#include <sys/wait.h>
+
+using namespace gr;
+
+namespace {
+
+constexpr std::size_t n_samples = 10'000'000;
+constexpr int         n_repeat  = 10;
+
+void
+write_all(int fd, const void *data, std::size_t n_bytes) {
+    const auto *ptr = static_cast<const std::byte *>(data);
+    while (n_bytes > 0) {
+        const ssize_t n = ::write(fd, ptr, n_bytes);
+        if (n <= 0) {
+            throw std::runtime_error(fmt::format("write failed: {}", strerror(errno)));
+        }
+        ptr += n;
+        n_bytes -= static_cast<std::size_t>(n);
+    }
+}
+
+void
+read_all(int fd, void *data, std::size_t n_bytes) {
+    auto *ptr = static_cast<std::byte *>(data);
+    while (n_bytes > 0) {
+        const ssize_t n = ::read(fd, ptr, n_bytes);
+        if (n <= 0) {
+            throw std::runtime_error(fmt::format("read failed: {}", strerror(errno)));
+        }
+        ptr += n;
+        n_bytes -= static_cast<std::size_t>(n);
+    }
+}
+
+/**
+ * forks a consumer process, runs 'consumer(socket)' in the child and 'producer(socket)' in the parent
+ */
+template<typename Producer, typename Consumer>
+void
+run_two_processes(Producer &&producer, Consumer &&consumer) {
+    int sockets[2];
+    if (::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) != 0) {
+        throw std::runtime_error(fmt::format("socketpair failed: {}", strerror(errno)));
+    }
+    const pid_t pid = ::fork();
+    if (pid == 0) { // consumer process
+        ::close(sockets[0]);
+        int status = 0;
+        try {
+            consumer(sockets[1]);
+        } catch (const std::exception &e) {
+            fmt::print(stderr, "consumer process failed: {}\n", e.what());
+            status = 1;
+        }
+        ::_exit(status); // N.B. skip the UT runner and static destructors of the forked parent image
+    }
+    ::close(sockets[1]);
+    producer(sockets[0]);
+    ::close(sockets[0]);
+    ::waitpid(pid, nullptr, 0);
+}
+
+} // namespace
+
+inline const boost::ut::suite _shared_buffer_tests = [] {
+    for (std::size_t veclen : { 64UL, 1024UL, 8192UL }) {
+        // reference: copy through a Unix domain socket, as done so far between acquisition and analysis processes
+        run_two_processes(
+                [veclen](int socket) {
+                    std::vector<int32_t> data(veclen);
+                    ::benchmark::benchmark<n_repeat>(fmt::format("two processes - Unix socket copy       -<{:^5}>-", veclen), n_samples) = [&] {
+                        for (std::size_t i = 0; i < n_samples; i += veclen) {
+                            write_all(socket, data.data(), data.size() * sizeof(int32_t));
+                        }
+                        char ack;
+                        read_all(socket, &ack, 1);
+                    };
+                },
+                [veclen](int socket) {
+                    std::vector<int32_t> data(veclen);
+                    for (int rep = 0; rep < n_repeat; rep++) {
+                        for (std::size_t i = 0; i < n_samples; i += veclen) {
+                            read_all(socket, data.data(), data.size() * sizeof(int32_t));
+                        }
+                        const char ack = 'A';
+                        write_all(socket, &ack, 1);
+                    }
+                });
+
+        // zero-copy: both processes map the same memfd, the consumer reads in-place
+        run_two_processes(
+                [veclen](int socket) {
+                    shared_circular_buffer<int32_t> buffer(65536, "bm_shared_buffer");
+                    shm::send_fd(socket, buffer.native_handle());
+                    char ready;
+                    read_all(socket, &ready, 1); // wait until the remote reader is registered
+                    BufferWriter auto writer = buffer.new_writer();
+                    ::benchmark::benchmark<n_repeat>(fmt::format("two processes - shared_circular_buffer -<{:^5}>-", veclen), n_samples) = [&] {
+                        for (std::size_t i = 0; i < n_samples; i += veclen) {
+                            writer.publish([](std::span<int32_t> &) {}, veclen);
+                        }
+                        char ack;
+                        read_all(socket, &ack, 1);
+                    };
+                },
+                [veclen](int socket) {
+                    auto              buffer = shared_circular_buffer<int32_t>::attach(shm::receive_fd(socket));
+                    BufferReader auto reader = buffer.new_reader();
+                    const char        ready  = 'R';
+                    write_all(socket, &ready, 1);
+                    for (int rep = 0; rep < n_repeat; rep++) {
+                        std::size_t n_consumed = 0;
+                        while (n_consumed < n_samples) {
+                            const auto data = reader.get();
+                            if (data.empty()) {
+                                std::this_thread::yield(); // N.B. relevant if both processes share a core
+                                continue;
+                            }
+                            ::benchmark::force_store(data.back());
+                            n_consumed += data.size();
+                            std::ignore = reader.consume(data.size());
+                        }
+                        const char ack = 'A';
+                        write_all(socket, &ack, 1);
+                    }
+                });
+        benchmark::results::add_separator();
+    }
+};
+#endif
+
+int
+main() { /* not needed by the UT framework */
+}
@@ -0,0 +1,171 @@
+#include "benchmark.hpp"
+
+#include <boost/ut.hpp>
+#include <flat_property_map.hpp>
+#include <graph.hpp>
+#include <scheduler.hpp>
+
+#include "bm_test_helper.hpp"
+
+namespace fg                           = fair::graph;
+using namespace fair::literals;
+
+inline constexpr std::size_t N_ITER    = 10;
+inline constexpr std::size_t N_SAMPLES = gr::util::round_up(10'000'000, 1024);
+
+inline static std::size_t n_samples_produced = 0_UZ;
+inline static std::size_t n_samples_consumed = 0_UZ;
+inline static std::size_t n_tags_consumed    = 0_UZ;
+
+/**
+ * source publishing a tag every 'tag_interval' samples, i.e. a tag density of 1/tag_interval
+ */
+template<typename T>
+class tagged_source : public fg::node<tagged_source<T>, fg::OUT<T, 0, N_MAX, "out">> {
+    std::size_t _tag_interval;
+
+public:
+    explicit tagged_source(std::size_t tag_interval) : _tag_interval(tag_interval) {}
+
+    fg::work_return_t
+    work() {
+        auto             &port        = fg::output_port<"out">(this);
+        auto             &writer      = port.streamWriter();
+        const std::size_t n_remaining = N_SAMPLES - n_samples_produced;
+        if (n_remaining == 0) {
+            return fg::work_return_t::DONE;
+        }
+        const std::size_t n_to_next_tag = _tag_interval - n_samples_produced % _tag_interval;
+        const std::size_t n_write       = std::min({ n_remaining, n_to_next_tag, writer.available(), port.max_buffer_size() });
+        if (n_write == 0) {
+            return fg::work_return_t::INSUFFICIENT_OUTPUT_ITEMS;
+        }
+        if (n_samples_produced % _tag_interval == 0) {
+            fg::publish_tag(port, { fg::tag::TRIGGER_TIME(static_cast<uint64_t>(n_samples_produced)), { "tag_counter", static_cast<uint64_t>(n_samples_produced / _tag_interval) } });
+        }
+        writer.publish([](std::span<T> output) { std::ranges::fill(output, T{ 1 }); }, n_write);
+        n_samples_produced += n_write;
+        return fg::work_return_t::OK;
+    }
+};
+
+template<typename T>
+class tag_counting_sink : public fg::node<tag_counting_sink<T>, fg::IN<T, 0, N_MAX, "in">> {
+public:
+    [[nodiscard]] fg::work_return_t
+    process_bulk(std::span<const T> input) noexcept {
+        if (this->input_tags_present()) {
+            n_tags_consumed++;
+            this->acknowledge_input_tags();
+        }
+        n_samples_consumed += input.size();
+        benchmark::force_store(input.back());
+        return fg::work_return_t::OK;
+    }
+};
+
+template<typename T>
+class pass_through : public fg::node<pass_through<T>, fg::IN<T, 0, N_MAX, "in">, fg::OUT<T, 0, N_MAX, "out">> {
+public:
+    template<fair::meta::t_or_simd<T> V>
+    [[nodiscard]] constexpr V
+    process_one(const V &a) const noexcept {
+        return a;
+    }
+};
+
+fg::graph
+tagged_graph(std::size_t tag_interval, std::size_t depth) {
+    using namespace boost::ut;
+    fg::graph flow_graph;
+    auto     &src  = flow_graph.make_node<tagged_source<float>>(tag_interval);
+    auto     &sink = flow_graph.make_node<tag_counting_sink<float>>();
+
+    std::vector<pass_through<float> *> blocks;
+    for (std::size_t i = 0; i < depth; i++) {
+        blocks.emplace_back(std::addressof(flow_graph.make_node<pass_through<float>>()));
+    }
+    expect(eq(fg::connection_result_t::SUCCESS, flow_graph.connect<"out">(src).to<"in">(*blocks.front())));
+    for (std::size_t i = 1; i < blocks.size(); i++) {
+        expect(eq(fg::connection_result_t::SUCCESS, flow_graph.connect<"out">(*blocks[i - 1]).to<"in">(*blocks[i])));
+    }
+    expect(eq(fg::connection_result_t::SUCCESS, flow_graph.connect<"out">(*blocks.back()).to<"in">(sink)));
+    return flow_graph;
+}
+
+/**
+ * emulates the per-tag work of node::work(): merge the tags of two inputs and forward the merged map to one output
+ */
+template<typename Map>
+void
+merge_and_forward(const Map &tag_in0, const Map &tag_in1, Map &merged, Map &tag_out) {
+    merged.clear();
+    if constexpr (std::is_same_v<Map, fg::property_map>) {
+        merged.insert(tag_in0.begin(), tag_in0.end());
+        merged.insert(tag_in1.begin(), tag_in1.end());
+    } else {
+        merged.insert(tag_in0);
+        merged.insert(tag_in1);
+    }
+    tag_out = merged;
+    benchmark::force_store(tag_out);
+}
+
+[[maybe_unused]] inline const boost::ut::suite _tag_benchmarks = [] {
+    using namespace boost::ut;
+    using namespace benchmark;
+
+    for (const std::size_t tag_interval : { 64UL, 1024UL, 16384UL, 65536UL }) {
+        fg::scheduler::simple sched(tagged_graph(tag_interval, 4));
+        ::benchmark::benchmark<N_ITER>(fmt::format("tag density 1/{:<5} - source -> 4 x pass-through -> sink", tag_interval), N_SAMPLES) = [&sched, tag_interval] {
+            n_samples_produced = 0_UZ;
+            n_samples_consumed = 0_UZ;
+            n_tags_consumed    = 0_UZ;
+            sched.work();
+            expect(eq(n_samples_consumed, N_SAMPLES)) << fmt::format("did not consume enough input samples for 1/{}", tag_interval);
+            expect(eq(n_tags_consumed, (N_SAMPLES + tag_interval - 1) / tag_interval)) << fmt::format("did not receive all tags for 1/{}", tag_interval);
+        };
+    }
+
+    constexpr std::size_t n_tags = 1'000'000;
+    {
+        const fg::property_map tag_in0{ fg::tag::TRIGGER_TIME(uint64_t{ 42 }), { "tag_counter", uint64_t{ 1 } } };
+        const fg::property_map tag_in1{ fg::tag::SAMPLE_RATE(48'000.f), fg::tag::TRIGGER_TIME(uint64_t{ 43 }) };
+        fg::property_map       merged;
+        fg::property_map       tag_out;
+        "property_map      - merge 2 inputs + forward"_benchmark.repeat<N_ITER>(n_tags) = [&] {
+            for (std::size_t i = 0; i < n_tags; i++) {
+                merge_and_forward(tag_in0, tag_in1, merged, tag_out);
+            }
+        };
+    }
+    {
+        const fg::flat_property_map tag_in0{ fg::tag::TRIGGER_TIME(uint64_t{ 42 }), { "tag_counter", uint64_t{ 1 } } };
+        const fg::flat_property_map tag_in1{ fg::tag::SAMPLE_RATE(48'000.f), fg::tag::TRIGGER_TIME(uint64_t{ 43 }) };
+        fg::flat_property_map       merged;
+        fg::flat_property_map       tag_out;
+        "flat_property_map - merge 2 inputs + forward"_benchmark.repeat<N_ITER>(n_tags) = [&] {
+            for (std::size_t i = 0; i < n_tags; i++) {
+                merge_and_forward(tag_in0, tag_in1, merged, tag_out);
+            }
+        };
+    }
+    {
+        const fg::property_map      map{ fg::tag::TRIGGER_TIME(uint64_t{ 42 }), fg::tag::SAMPLE_RATE(48'000.f), { "tag_counter", uint64_t{ 1 } } };
+        const fg::flat_property_map flat_map(map);
+        "property_map      - lookup tag::SAMPLE_RATE"_benchmark.repeat<N_ITER>(n_tags) = [&map] {
+            for (std::size_t i = 0; i < n_tags; i++) {
+                force_store(map.at(fg::tag::SAMPLE_RATE));
+            }
+        };
+        "flat_property_map - lookup tag::SAMPLE_RATE"_benchmark.repeat<N_ITER>(n_tags) = [&flat_map] {
+            for (std::size_t i = 0; i < n_tags; i++) {
+                force_store(flat_map.at(fg::tag::SAMPLE_RATE));
+            }
+        };
+    }
+};
+
+int
+main() { /* not needed by the UT framework */
+}
@@ -62,6 +62,32 @@ struct Visible {};
  */
 struct BlockingIO {};
 
+/**
+ * @brief Annotates node, indicating that its 'process_bulk(..)' handles several tags per call: the available samples are
+ * not split at every tag but only where a tag changes the node's settings. The tags of a call are accessible via 'input_tag_batch()'.
+ */
+struct BatchedTags {};
+
+/**
+ * @brief Annotates node, indicating a fixed N:M sample-rate ratio between its inputs and outputs, i.e. 'process_bulk(..)'
+ * is called with multiples of 'InputChunkSize' input and the corresponding multiples of 'OutputChunkSize' output samples.
+ * For example: 'ResamplingRatio<4, 1>' -> decimator by four, 'ResamplingRatio<1, 3>' -> interpolator by three.
+ */
+template<std::size_t InputChunkSize, std::size_t OutputChunkSize = 1>
+struct ResamplingRatio {
+    static_assert(InputChunkSize > 0 && OutputChunkSize > 0, "chunk sizes must be non-zero");
+    static constexpr std::size_t input_chunk_size  = InputChunkSize;
+    static constexpr std::size_t output_chunk_size = OutputChunkSize;
+};
+
+template<typename T>
+struct is_resampling_ratio : std::false_type {};
+
+template<std::size_t N, std::size_t M>
+struct is_resampling_ratio<ResamplingRatio<N, M>> : std::true_type {};
+
+using DefaultResamplingRatio = ResamplingRatio<1, 1>;
+
 /**
  * @brief Annotates templated node, indicating which port data types are supported.
  */
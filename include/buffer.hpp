@@ -66,6 +66,7 @@ concept BufferWriter = requires(T t, const std::size_t n_items, std::pair<std::s
     { t.try_publish([](std::span<util::value_type_t<T>> &/*writable_data*/, Args ...) { /* */ }, n_items, args...) }                             -> std::same_as<bool>;
     { t.try_publish([](std::span<util::value_type_t<T>> &/*writable_data*/, std::make_signed_t<std::size_t> /* writePos */, Args ...) { /* */  }, n_items, args...) }-> std::same_as<bool>;
     { t.reserve_output_range(n_items) };
+    { t.try_reserve_output_range(n_items) }; // N.B. non-blocking, empty range if there is not enough space
     { t.available() }         -> std::same_as<std::size_t>;
     { t.buffer() };
 };
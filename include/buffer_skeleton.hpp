@@ -88,6 +88,11 @@ class buffer_skeleton {
             return { &_buffer->_data[0], n };
         }
 
+        [[nodiscard]] constexpr auto
+        try_reserve_output_range(std::size_t n) noexcept -> std::span<U> {
+            return { &_buffer->_data[0], n };
+        }
+
         constexpr void
         publish(std::pair<std::size_t, std::make_signed<std::size_t>>, std::size_t) const { /* empty */
         }
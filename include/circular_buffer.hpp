@@ -13,12 +13,21 @@ using polymorphic_allocator = std::experimental::pmr::polymorphic_allocator<T>;
 #include <memory_resource>
 #endif
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <bit>
 #include <cassert> // to assert if compiled for debugging
+#include <cstdio>
+#include <cstring>
 #include <functional>
+#include <limits>
+#include <mutex>
 #include <numeric>
 #include <ranges>
 #include <span>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
 
 #include <fmt/format.h>
 
@@ -28,6 +37,7 @@ using polymorphic_allocator = std::experimental::pmr::polymorphic_allocator<T>;
 #if defined __has_include && not __EMSCRIPTEN__
 #if __has_include(<sys/mman.h>) && __has_include(<sys/stat.h>) && __has_include(<unistd.h>)
 #include <sys/mman.h>
+#include <sys/resource.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
@@ -54,6 +64,33 @@ static constexpr bool has_posix_mmap_interface = false;
 
 namespace gr {
 
+/**
+ * @brief outcome of prefaulting and pinning (mlock) buffer memory, e.g. to avoid the page-fault jitter of the first pass
+ * over freshly mapped buffers. Failures are usually due to exceeding the 'RLIMIT_MEMLOCK' limit (see 'ulimit -l').
+ */
+struct memory_lock_result {
+    std::size_t locked_bytes  = 0;
+    std::size_t failed_bytes  = 0; // prefaulted but not pinned
+    std::size_t n_failures    = 0;
+    int         error         = 0;                                       // errno of the last failed 'mlock(..)'
+    std::size_t memlock_limit = std::numeric_limits<std::size_t>::max(); // 'RLIMIT_MEMLOCK' soft limit, max() if unlimited
+
+    [[nodiscard]] constexpr bool
+    ok() const noexcept {
+        return n_failures == 0;
+    }
+
+    constexpr memory_lock_result &
+    operator+=(const memory_lock_result &other) noexcept {
+        locked_bytes += other.locked_bytes;
+        failed_bytes += other.failed_bytes;
+        n_failures += other.n_failures;
+        error         = other.error != 0 ? other.error : error;
+        memlock_limit = std::min(memlock_limit, other.memlock_limit);
+        return *this;
+    }
+};
+
 namespace util {
 constexpr std::size_t
 round_up(std::size_t num_to_round, std::size_t multiple) noexcept {
@@ -66,10 +103,136 @@ round_up(std::size_t num_to_round, std::size_t multiple) noexcept {
     }
     return num_to_round + multiple - remainder;
 }
+
+/**
+ * @return the 'RLIMIT_MEMLOCK' soft limit in bytes, std::numeric_limits<std::size_t>::max() if unlimited or unknown
+ */
+[[nodiscard]] inline std::size_t
+memlock_limit() noexcept {
+#ifdef HAS_POSIX_MAP_INTERFACE
+    if (rlimit limit{}; getrlimit(RLIMIT_MEMLOCK, &limit) == 0 && limit.rlim_cur != RLIM_INFINITY) {
+        return limit.rlim_cur;
+    }
+#endif
+    return std::numeric_limits<std::size_t>::max();
+}
+
+/**
+ * prefaults (i.e. populates the page tables writable) and pins the memory range [p, p + n_bytes) to physical memory,
+ * the range is extended to page boundaries. The memory is prefaulted even if it cannot be pinned.
+ */
+[[nodiscard]] inline memory_lock_result
+lock_memory(const void *p, std::size_t n_bytes) noexcept {
+    memory_lock_result result{ .memlock_limit = memlock_limit() };
+    if (p == nullptr || n_bytes == 0) {
+        return result;
+    }
+#ifdef HAS_POSIX_MAP_INTERFACE
+    const auto pageSize = static_cast<std::size_t>(getpagesize());
+    const auto start    = reinterpret_cast<std::uintptr_t>(p) & ~(pageSize - 1);
+    const auto length   = round_up(reinterpret_cast<std::uintptr_t>(p) + n_bytes, pageSize) - start;
+    auto      *address  = reinterpret_cast<void *>(start);
+#ifdef MADV_POPULATE_WRITE
+    const bool populated = madvise(address, length, MADV_POPULATE_WRITE) == 0;
+#else
+    const bool populated = false;
+#endif
+    if (!populated) { // older kernels: read-fault each page, 'mlock(..)' faults-in the remaining ones (if permitted)
+        for (std::uintptr_t page = start; page < start + length; page += pageSize) {
+            static_cast<void>(*reinterpret_cast<const volatile char *>(page));
+        }
+    }
+    if (mlock(address, length) == 0) {
+        result.locked_bytes = length;
+    } else {
+        result.failed_bytes = length;
+        result.n_failures   = 1;
+        result.error        = errno;
+    }
+#else
+    result.failed_bytes = n_bytes;
+    result.n_failures   = 1;
+    result.error        = ENOSYS;
+#endif
+    return result;
+}
+
+inline void
+unlock_memory(const void *p, std::size_t n_bytes) noexcept {
+#ifdef HAS_POSIX_MAP_INTERFACE
+    if (p != nullptr && n_bytes > 0) {
+        const auto pageSize = static_cast<std::size_t>(getpagesize());
+        const auto start    = reinterpret_cast<std::uintptr_t>(p) & ~(pageSize - 1);
+        munlock(reinterpret_cast<void *>(start), round_up(reinterpret_cast<std::uintptr_t>(p) + n_bytes, pageSize) - start);
+    }
+#else
+    std::ignore = p;
+    std::ignore = n_bytes;
+#endif
+}
 } // namespace util
 
+/**
+ * @brief minimum alignment of the buffers' sample storage: covers the widest 'stdx::vector_aligned' access of the SIMD
+ * loops in 'node::work()' (i.e. 32 x 8-byte samples), so that the alignment prologue of these loops is empty as long as
+ * samples are produced/consumed in multiples of the SIMD width
+ */
+inline constexpr std::size_t simd_buffer_alignment = 256;
+
+/**
+ * @brief memory resource adaptor over-aligning all allocations of its upstream resource to (at least) 'simd_buffer_alignment'
+ * N.B. the double-mapped resources below are page-aligned by construction
+ */
+class aligned_memory_resource : public std::pmr::memory_resource {
+    std::pmr::memory_resource *_upstream;
+
+public:
+    explicit aligned_memory_resource(std::pmr::memory_resource *upstream = std::pmr::get_default_resource()) noexcept : _upstream(upstream) {}
+
+    [[nodiscard]] std::pmr::memory_resource *upstream_resource() const noexcept { return _upstream; }
+
+private:
+    [[nodiscard]] void *do_allocate(std::size_t bytes, std::size_t alignment) override { return _upstream->allocate(bytes, std::max(alignment, simd_buffer_alignment)); }
+
+    void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override { _upstream->deallocate(p, bytes, std::max(alignment, simd_buffer_alignment)); }
+
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+        const auto *aligned = dynamic_cast<const aligned_memory_resource *>(&other);
+        return aligned != nullptr && _upstream->is_equal(*aligned->_upstream);
+    }
+};
+
 // clang-format off
+/**
+ * @brief memory resource mapping the same (anonymous) memory segment twice and back-to-back into the virtual address
+ * space, so that accesses beyond the end of the first segment transparently wrap around to its beginning.
+ *
+ * The resource optionally backs the segment with huge pages (e.g. 2 MiB instead of 4 KiB) to reduce the TLB pressure
+ * for large (i.e. > 10 MiB) buffers. The following fall-back strategy is used:
+ *  a) explicit huge pages via 'memfd_create(.., MFD_HUGETLB)' if the system has enough reserved huge pages
+ *     (see '/proc/sys/vm/nr_hugepages'),
+ *  b) transparent huge pages, i.e. standard pages whose double-mapping is aligned to the huge-page boundary and
+ *     advised via 'madvise(.., MADV_HUGEPAGE)' -- the kernel may (or may not) promote these opportunistically,
+ *  c) standard pages.
+ * The page size that has been effectively obtained for a given allocation can be queried via 'page_size(void*)'.
+ *
+ * The resource optionally prefaults and pins ('mlock(..)') its allocations to physical memory so that the first pass
+ * over a new buffer does not take a page fault per page, e.g. for real-time graphs with tight latency budgets after
+ * start-up. Pinning is subject to the 'RLIMIT_MEMLOCK' limit, failures are non-fatal (the memory is still prefaulted)
+ * and reported via 'lock_statistics()'.
+ *
+ * N.B. the huge-page variant requires the allocation size to be a multiple of the huge-page size, i.e.
+ * 'page_size()' returns the allocation granularity that users (e.g. the circular_buffer) need to align to.
+ */
 class double_mapped_memory_resource : public std::pmr::memory_resource {
+    const bool                                    _use_huge_pages;
+    const bool                                    _lock_memory;
+    mutable std::mutex                            _page_size_lock;
+    std::unordered_map<const void*, std::size_t>  _page_sizes; // allocation -> effectively obtained page size
+    std::unordered_map<const void*, std::size_t>  _locked_sizes; // allocation -> pinned bytes
+    memory_lock_result                            _lock_statistics; // N.B. 'locked_bytes': currently pinned allocations
+
+protected:
 #ifdef HAS_POSIX_MAP_INTERFACE
     [[nodiscard]] void* do_allocate(const std::size_t required_size, std::size_t alignment) override {
 
@@ -77,53 +240,101 @@ class double_mapped_memory_resource : public std::pmr::memory_resource {
         if (size % static_cast<std::size_t>(getpagesize()) != 0LU) {
             throw std::runtime_error(fmt::format("incompatible buffer-byte-size: {} -> {} alignment: {} vs. page size: {}", required_size, size, alignment, getpagesize()));
         }
-        const std::size_t size_half = size/2;
 
-        static std::size_t _counter;
+        static std::atomic<std::size_t> _counter;
         const auto buffer_name = fmt::format("/double_mapped_memory_resource-{}-{}-{}", getpid(), size, _counter++);
-        const auto memfd_create = [name = buffer_name.c_str()](unsigned int flags) -> long {
-            return syscall(__NR_memfd_create, name, flags);
-        };
-        int shm_fd = static_cast<int>(memfd_create(0));
-        if (shm_fd < 0) {
-            throw std::runtime_error(fmt::format("{} - memfd_create error {}: {}",  buffer_name, errno, strerror(errno)));
+
+        void* result = nullptr;
+        std::size_t obtained_page_size = static_cast<std::size_t>(getpagesize());
+        if (_use_huge_pages && required_size % huge_page_size() == 0LU) {
+            // explicit huge-pages: fails gracefully (i.e. returns nullptr) if there are not enough reserved pages
+            if (result = map_double(buffer_name, required_size, huge_page_size(), MFD_HUGETLB, false); result != nullptr) {
+                obtained_page_size = huge_page_size();
+            } else {
+                // transparent huge-pages: huge-page aligned standard-page mapping advised for promotion
+                result = map_double(buffer_name, required_size, huge_page_size(), 0U, true);
+            }
+        } else {
+            result = map_double(buffer_name, required_size, static_cast<std::size_t>(getpagesize()), 0U, true);
+        }
+
+        memory_lock_result locked;
+        if (_lock_memory) {
+            locked = util::lock_memory(result, size); // N.B. both copies, each counts against 'RLIMIT_MEMLOCK'
         }
 
-        if (ftruncate(shm_fd, static_cast<off_t>(size)) == -1) {
-            close(shm_fd);
-            throw std::runtime_error(fmt::format("{} - ftruncate {}: {}",  buffer_name, errno, strerror(errno)));
+        if (_use_huge_pages || _lock_memory) { // N.B. the default resource has no book-keeping, i.e. neither locks nor map look-ups
+            std::lock_guard lock(_page_size_lock);
+            if (_use_huge_pages) {
+                _page_sizes.insert_or_assign(result, obtained_page_size);
+            }
+            if (locked.locked_bytes > 0) {
+                _locked_sizes.insert_or_assign(result, locked.locked_bytes);
+            }
+            _lock_statistics += locked;
         }
+        return result;
+    }
+
+    /**
+     * maps a memfd-backed segment of size 'size_half' twice and back-to-back into an address range that is first reserved
+     * (aligned to 'alignment') and then replaced by the two fixed mappings. This avoids the otherwise possible race with
+     * other threads mapping memory into the hole between the first and second copy.
+     * @return start address of the double-mapped region, or nullptr if the mapping could not be established and
+     * 'throw_on_error' is false
+     */
+    static void* map_double(const std::string &buffer_name, const std::size_t size_half, const std::size_t alignment, const unsigned int memfd_flags, const bool throw_on_error) {
+        // N.B. 'error' is the errno of the failed call, captured before any cleanup (munmap, close) may overwrite it
+        const auto fail = [&buffer_name, throw_on_error](int fd, int error, std::string_view what) -> void* {
+            if (fd >= 0) {
+                close(fd);
+            }
+            if (throw_on_error) {
+                throw std::runtime_error(fmt::format("{} - {} {}: {}", buffer_name, what, error, strerror(error)));
+            }
+            return nullptr;
+        };
+        const std::size_t size = 2 * size_half;
 
-        void* first_copy = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, shm_fd, static_cast<off_t>(0));
-        if (first_copy == MAP_FAILED) {
-            close(shm_fd);
-            throw std::runtime_error(fmt::format("{} - failed munmap for first half {}: {}",  buffer_name, errno, strerror(errno)));
+        const int shm_fd = static_cast<int>(syscall(__NR_memfd_create, buffer_name.c_str(), memfd_flags));
+        if (shm_fd < 0) {
+            return fail(shm_fd, errno, "memfd_create error");
         }
 
-        // unmap the 2nd half
-        if (munmap(static_cast<char*>(first_copy) + size_half, size_half) == -1) {
-            close(shm_fd);
-            throw std::runtime_error(fmt::format("{} - failed munmap for second half {}: {}",  buffer_name, errno, strerror(errno)));
+        if (ftruncate(shm_fd, static_cast<off_t>(size_half)) == -1) {
+            return fail(shm_fd, errno, "ftruncate");
         }
 
-        // Map the first half into the now available hole.
-        // Note that the second_copy_addr mmap argument is only a hint and mmap might place the
-        // mapping somewhere else: "If addr is not NULL, then the kernel takes it as  a hint about
-        // where to place the mapping". The returned pointer therefore must equal second_copy_addr
-        // for our contiguous mapping to work as intended.
-        void* second_copy_addr = static_cast<char*> (first_copy) + size_half;
-        if (const void* result = mmap(second_copy_addr, size_half, PROT_READ | PROT_WRITE, MAP_SHARED, shm_fd, static_cast<off_t> (0)); result != second_copy_addr) {
-            close(shm_fd);
-            if (result == MAP_FAILED) {
-                throw std::runtime_error(fmt::format("{} - failed mmap for second copy {}: {}",  buffer_name, errno, strerror(errno)));
-            } else {
-                throw std::runtime_error(fmt::format("{} - failed mmap for second copy: mismatching address", buffer_name));
+        // reserve an aligned address range that is large enough for both copies
+        void* reserved = mmap(nullptr, size + alignment, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, static_cast<off_t>(0));
+        if (reserved == MAP_FAILED) {
+            return fail(shm_fd, errno, "failed address-range reservation");
+        }
+        const auto reserved_start = reinterpret_cast<std::uintptr_t>(reserved);
+        const auto aligned_start  = util::round_up(reserved_start, alignment);
+        if (const std::size_t head = aligned_start - reserved_start; head > 0) {
+            munmap(reserved, head);
+        }
+        if (const std::size_t tail = alignment - (aligned_start - reserved_start); tail > 0) {
+            munmap(reinterpret_cast<void*>(aligned_start + size), tail);
+        }
+        auto* first_copy = reinterpret_cast<char*>(aligned_start);
+
+        // map the same memory twice into the reserved range: [first_copy, first_copy + size_half) and [first_copy + size_half, first_copy + size)
+        for (char* copy : { first_copy, first_copy + size_half }) {
+            if (mmap(copy, size_half, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, shm_fd, static_cast<off_t>(0)) == MAP_FAILED) {
+                const int error = errno;
+                munmap(first_copy, size);
+                return fail(shm_fd, error, "failed mmap for buffer copy");
             }
         }
+        if (memfd_flags == 0U && alignment > static_cast<std::size_t>(getpagesize())) {
+            madvise(first_copy, size, MADV_HUGEPAGE); // N.B. advisory only, failure is non-critical
+        }
 
         close(shm_fd); // file-descriptor is no longer needed. The mapping is retained.
         return first_copy;
-}
+    }
 #else
     [[nodiscard]] void* do_allocate(const std::size_t, std::size_t) override {
         throw std::runtime_error("OS does not provide POSIX interface for mmap(...) and munmao(...)");
@@ -134,8 +345,15 @@ class double_mapped_memory_resource : public std::pmr::memory_resource {
 
 #ifdef HAS_POSIX_MAP_INTERFACE
     void  do_deallocate(void* p, std::size_t size, size_t alignment) override {
-
-        if (munmap(p, size) == -1) {
+        if (_use_huge_pages || _lock_memory) {
+            std::lock_guard lock(_page_size_lock);
+            _page_sizes.erase(p);
+            if (const auto it = _locked_sizes.find(p); it != _locked_sizes.end()) {
+                _lock_statistics.locked_bytes -= it->second; // N.B. munmap(..) implicitly unlocks
+                _locked_sizes.erase(it);
+            }
+        }
+        if (munmap(p, 2 * size) == -1) { // N.B. releases both the original and the mirrored copy
             throw std::runtime_error(fmt::format("double_mapped_memory_resource::do_deallocate(void*, {}, {}) - munmap(..) failed", size, alignment));
         }
     }
@@ -146,20 +364,243 @@ class double_mapped_memory_resource : public std::pmr::memory_resource {
     bool  do_is_equal(const memory_resource& other) const noexcept override { return this == &other; }
 
 public:
+    explicit double_mapped_memory_resource(bool use_huge_pages = false, bool lock_memory = false) noexcept : _use_huge_pages(use_huge_pages), _lock_memory(lock_memory) {}
+
+    /**
+     * @return the system's default huge-page size (typically 2 MiB on x86_64), or the standard page size if unknown
+     */
+    [[nodiscard]] static std::size_t huge_page_size() noexcept {
+#ifdef HAS_POSIX_MAP_INTERFACE
+        static const std::size_t hugePageSize = [] {
+            std::size_t value = 0;
+            if (FILE* meminfo = std::fopen("/proc/meminfo", "r"); meminfo != nullptr) {
+                char line[128];
+                while (std::fgets(line, sizeof(line), meminfo) != nullptr) {
+                    if (unsigned long kB = 0; std::sscanf(line, "Hugepagesize: %lu kB", &kB) == 1) {
+                        value = kB * 1024UL;
+                        break;
+                    }
+                }
+                std::fclose(meminfo);
+            }
+            return value > 0 ? value : static_cast<std::size_t>(getpagesize());
+        }();
+        return hugePageSize;
+#else
+        return 4096LU;
+#endif
+    }
+
+    [[nodiscard]] bool uses_huge_pages() const noexcept { return _use_huge_pages; }
+    [[nodiscard]] bool locks_memory() const noexcept { return _lock_memory; }
+
+    /**
+     * @return bytes of the allocations that are currently pinned as well as the accumulated failures, see 'util::lock_memory(..)'
+     */
+    [[nodiscard]] memory_lock_result lock_statistics() const noexcept {
+        std::lock_guard lock(_page_size_lock);
+        memory_lock_result result = _lock_statistics;
+        result.memlock_limit = util::memlock_limit();
+        return result;
+    }
+
+    /**
+     * @return allocation granularity: allocation sizes need to be a multiple of this value
+     */
+    [[nodiscard]] std::size_t page_size() const noexcept {
+#ifdef HAS_POSIX_MAP_INTERFACE
+        return _use_huge_pages ? huge_page_size() : static_cast<std::size_t>(getpagesize());
+#else
+        return 4096LU;
+#endif
+    }
+
+    /**
+     * @return the page size that effectively backs the allocation 'p' (e.g. the standard page size if the huge-page
+     * allocation fell back to standard pages), or 0 if 'p' has not been allocated by this resource.
+     * N.B. transparent huge-pages are reported with the standard page size since their promotion is at the kernel's discretion.
+     * Resources without huge pages do not track their allocations and report the standard page size for any 'p'.
+     */
+    [[nodiscard]] std::size_t page_size(const void* p) const noexcept {
+        if (!_use_huge_pages) {
+            return page_size();
+        }
+        std::lock_guard lock(_page_size_lock);
+        if (const auto it = _page_sizes.find(p); it != _page_sizes.end()) {
+            return it->second;
+        }
+        return 0LU;
+    }
+
+    // N.B. instances are intentionally never destroyed since buffers may be released during static destruction
     static inline double_mapped_memory_resource* defaultAllocator() {
-        static auto instance = double_mapped_memory_resource();
-        return &instance;
+        static auto* instance = new double_mapped_memory_resource();
+        return instance;
+    }
+
+    static inline double_mapped_memory_resource* hugePageAllocator() {
+        static auto* instance = new double_mapped_memory_resource(true);
+        return instance;
+    }
+
+    static inline double_mapped_memory_resource* lockedAllocator(bool use_huge_pages = false) {
+        static auto* instance = new double_mapped_memory_resource(false, true);
+        static auto* hugePageInstance = new double_mapped_memory_resource(true, true);
+        return use_huge_pages ? hugePageInstance : instance;
+    }
+
+    template<typename T>
+    static inline std::pmr::polymorphic_allocator<T> allocator(bool use_huge_pages = false, bool lock_memory = false)
+    {
+        if (lock_memory) {
+            return std::pmr::polymorphic_allocator<T>(gr::double_mapped_memory_resource::lockedAllocator(use_huge_pages));
+        }
+        return std::pmr::polymorphic_allocator<T>(use_huge_pages ? gr::double_mapped_memory_resource::hugePageAllocator() : gr::double_mapped_memory_resource::defaultAllocator());
+    }
+};
+
+/**
+ * @brief double_mapped_memory_resource that recycles released double-mapped allocations rather than unmapping them.
+ *
+ * Creating a double mapping requires several syscalls (memfd_create, ftruncate, mmap, munmap) which dominates the
+ * start-up, re-connection, or buffer-resize time of graphs with many ports. Released mappings are kept in buckets of
+ * identical byte-size and handed out again for allocations of the same size. The amount of (non-virtual) memory kept
+ * in the cache is limited by 'cap()' bytes. Releases beyond that limit are unmapped immediately.
+ *
+ * N.B. recycled memory is not zeroed by the resource.
+ */
+class caching_double_mapped_memory_resource : public double_mapped_memory_resource {
+public:
+    struct statistics_t {
+        std::size_t hits               = 0; // allocations served from the cache
+        std::size_t misses             = 0; // allocations requiring a new mapping
+        std::size_t evictions          = 0; // releases that were unmapped because the cache was full
+        std::size_t cached_allocations = 0;
+        std::size_t cached_bytes       = 0;
+    };
+    static constexpr std::size_t default_cap = 64UL << 20; // 64 MiB
+
+private:
+    mutable std::mutex                                  _cache_lock;
+    std::unordered_map<std::size_t, std::vector<void*>> _cache; // byte-size -> released mappings
+    std::size_t                                         _cap;
+    statistics_t                                        _stats;
+
+    [[nodiscard]] void* do_allocate(const std::size_t required_size, std::size_t alignment) override {
+        {
+            std::lock_guard lock(_cache_lock);
+            if (auto it = _cache.find(required_size); it != _cache.end() && !it->second.empty()) {
+                void* p = it->second.back();
+                it->second.pop_back();
+                _stats.hits++;
+                _stats.cached_allocations--;
+                _stats.cached_bytes -= required_size;
+                return p;
+            }
+            _stats.misses++;
+        }
+        return double_mapped_memory_resource::do_allocate(required_size, alignment);
+    }
+
+    void do_deallocate(void* p, std::size_t size, size_t alignment) override {
+        {
+            std::lock_guard lock(_cache_lock);
+            if (_stats.cached_bytes + size <= _cap) {
+                _cache[size].push_back(p);
+                _stats.cached_allocations++;
+                _stats.cached_bytes += size;
+                return;
+            }
+            _stats.evictions++;
+        }
+        double_mapped_memory_resource::do_deallocate(p, size, alignment);
+    }
+
+    void trim_to(std::size_t max_bytes) {
+        std::vector<std::pair<void*, std::size_t>> released;
+        {
+            std::lock_guard lock(_cache_lock);
+            for (auto it = _cache.begin(); it != _cache.end() && _stats.cached_bytes > max_bytes; ++it) {
+                auto &[size, mappings] = *it;
+                while (!mappings.empty() && _stats.cached_bytes > max_bytes) {
+                    released.emplace_back(mappings.back(), size);
+                    mappings.pop_back();
+                    _stats.cached_allocations--;
+                    _stats.cached_bytes -= size;
+                }
+            }
+        }
+        for (const auto &[p, size] : released) { // N.B. munmap outside the lock
+            double_mapped_memory_resource::do_deallocate(p, size, alignof(std::max_align_t));
+        }
+    }
+
+public:
+    explicit caching_double_mapped_memory_resource(std::size_t cap = default_cap, bool use_huge_pages = false, bool lock_memory = false) noexcept : double_mapped_memory_resource(use_huge_pages, lock_memory), _cap(cap) {}
+    ~caching_double_mapped_memory_resource() override { release(); }
+
+    [[nodiscard]] std::size_t cap() const noexcept { std::lock_guard lock(_cache_lock); return _cap; }
+    void set_cap(std::size_t cap) {
+        {
+            std::lock_guard lock(_cache_lock);
+            _cap = cap;
+        }
+        trim_to(cap);
+    }
+
+    [[nodiscard]] statistics_t statistics() const noexcept { std::lock_guard lock(_cache_lock); return _stats; }
+    void reset_statistics() noexcept {
+        std::lock_guard lock(_cache_lock);
+        _stats.hits = _stats.misses = _stats.evictions = 0;
+    }
+
+    /**
+     * unmaps all cached (i.e. currently unused) mappings -- allocations in use are not affected
+     */
+    void release() { trim_to(0); }
+
+    static inline caching_double_mapped_memory_resource* defaultAllocator() {
+        static auto* instance = new caching_double_mapped_memory_resource();
+        return instance;
     }
 
     template<typename T>
     static inline std::pmr::polymorphic_allocator<T> allocator()
     {
-        return std::pmr::polymorphic_allocator<T>(gr::double_mapped_memory_resource::defaultAllocator());
+        return std::pmr::polymorphic_allocator<T>(gr::caching_double_mapped_memory_resource::defaultAllocator());
     }
 };
 
 
 
+/**
+ * @brief wrap-around handling of circular_buffers that are not backed by a 'double_mapped_memory_resource':
+ * Mirrored: every published sample is copied a second time past the buffer end, i.e. any range can be accessed
+ *           as one contiguous span at the expense of twice the memory bandwidth
+ * Split:    no mirror copy, ranges crossing the wrap-around point are accessible as (at most) two contiguous spans
+ * N.B. double-mapped buffers are inherently mirrored without copy, the mode has no effect for these.
+ */
+enum class WrapMode { Mirrored, Split };
+
+/**
+ * @brief reader flavours of circular_buffers:
+ * Gating:  default, the reader's position is registered with the buffer and back-pressures the writer
+ * Monitor: lossy and non-gating (e.g. GUI/monitoring taps) -- the writer never waits for these. If the writer laps the
+ *          reader by more than half the buffer size, the reader skips forward to the latest data and counts the
+ *          skipped samples as dropped (see 'n_dropped()'). Samples read just before being overrun may be torn.
+ */
+enum class ReaderMode { Gating, Monitor };
+
+/**
+ * @brief behaviour of the writer if the gating readers do not keep up, e.g. for hardware-clocked sources that cannot block:
+ * Block:      default, the writer waits until the readers freed enough space
+ * DropNewest: the samples to be written are discarded (the buffer content is retained)
+ * DropOldest: the writer overwrites the oldest unread samples and moves the lagging readers forward (single producer only)
+ * Dropped samples are counted by the writer (see 'n_dropped()'), readers of drop-oldest buffers count the samples they
+ * missed. N.B. 'try_publish(..)' never drops samples but returns 'false' if there is not enough space (drop-newest).
+ */
+enum class OverflowPolicy { Block, DropNewest, DropOldest };
+
 /**
  * @brief circular buffer implementation using double-mapped memory allocations
  * where the first SIZE-ed buffer is mirrored directly its end to mimic wrap-around
@@ -196,29 +637,58 @@ class circular_buffer
     using Allocator         = std::pmr::polymorphic_allocator<T>;
     using BufferType        = circular_buffer<T, SIZE, producer_type, WAIT_STRATEGY>;
     using ClaimType         = detail::producer_type_v<SIZE, producer_type, WAIT_STRATEGY>;
-    using DependendsType    = std::shared_ptr<std::vector<std::shared_ptr<Sequence>>>;
+    using WriterClaimType   = detail::producer_claim<ClaimType>;
     using signed_index_type = Sequence::signed_index_type;
 
     struct buffer_impl {
         Sequence                    _cursor;
         Allocator                   _allocator{};
         const bool                  _is_mmap_allocated;
+        const bool                  _is_split; // wrap-aware two-span mode w/o mirror copy
+        const OverflowPolicy        _overflow_policy;
         const std::size_t             _size; // pre-condition: std::has_single_bit(_size)
+        aligned_memory_resource     _aligned_resource; // over-aligns non-mmap allocations (see 'simd_buffer_alignment')
         std::vector<T, Allocator>   _data;
         WAIT_STRATEGY               _wait_strategy = WAIT_STRATEGY();
         ClaimType                   _claim_strategy;
-        // list of dependent reader indices
-        DependendsType              _read_indices{ std::make_shared<std::vector<std::shared_ptr<Sequence>>>() };
+        // contiguous table of dependent reader indices
+        SequenceTable               _read_indices;
+        std::atomic<std::size_t>    _n_monitor_readers{ 0 }; // non-gating readers, not part of '_read_indices'
+        // online resize (see 'buffer_writer::resize(..)'): the replacing buffer and the gating slots claimed there on behalf
+        // of this buffer's readers (key: the reader's slot 'id()' in this buffer) until they follow on their next access
+        std::atomic<buffer_impl *>  _successor{ nullptr };
+        std::shared_ptr<buffer_impl> _successor_owner;
+        std::mutex                  _handover_mutex;
+        std::unordered_map<const void *, SequenceTable::Slot> _handover_slots;
+        bool                        _memory_locked = false; // see 'lock_memory()'
 
         buffer_impl() = delete;
-        buffer_impl(const std::size_t min_size, Allocator allocator) : _allocator(allocator), _is_mmap_allocated(dynamic_cast<double_mapped_memory_resource *>(_allocator.resource())),
-            _size(align_with_page_size(std::bit_ceil(min_size), _is_mmap_allocated)), _data(buffer_size(_size, _is_mmap_allocated), _allocator), _claim_strategy(ClaimType(_cursor, _wait_strategy, _size)) {
+        buffer_impl(const std::size_t min_size, Allocator allocator, WrapMode wrap_mode, OverflowPolicy overflow_policy) : _allocator(allocator), _is_mmap_allocated(dynamic_cast<double_mapped_memory_resource *>(_allocator.resource())),
+            _is_split(!_is_mmap_allocated && wrap_mode == WrapMode::Split), _overflow_policy(overflow_policy),
+            _size(align_with_page_size(std::bit_ceil(min_size), dynamic_cast<double_mapped_memory_resource *>(_allocator.resource()))), _aligned_resource(_allocator.resource()),
+            _data(buffer_size(_size, _is_mmap_allocated || _is_split), _is_mmap_allocated ? _allocator : Allocator(&_aligned_resource)), _claim_strategy(ClaimType(_cursor, _wait_strategy, _size)) {
+        }
+        buffer_impl(const buffer_impl&) = delete;
+        buffer_impl& operator=(const buffer_impl&) = delete;
+        ~buffer_impl() {
+            if (_memory_locked) {
+                util::unlock_memory(_data.data(), memory_size());
+            }
+        }
+
+        // N.B. double-mapped buffers: both copies are mapped (and pinned) separately
+        [[nodiscard]] std::size_t memory_size() const noexcept { return (_is_mmap_allocated ? 2 * _size : _data.size()) * sizeof(T); }
+
+        memory_lock_result lock_memory() noexcept {
+            const memory_lock_result result = util::lock_memory(_data.data(), memory_size());
+            _memory_locked                  = _memory_locked || result.locked_bytes > 0; // N.B. only pinned memory needs to be unpinned
+            return result;
         }
 
 #ifdef HAS_POSIX_MAP_INTERFACE
-        static std::size_t align_with_page_size(const std::size_t min_size, bool _is_mmap_allocated) {
-            if (_is_mmap_allocated) {
-                const std::size_t pageSize = static_cast<std::size_t>(getpagesize());
+        static std::size_t align_with_page_size(const std::size_t min_size, const double_mapped_memory_resource* mmap_resource) {
+            if (mmap_resource != nullptr) {
+                const std::size_t pageSize = mmap_resource->page_size(); // N.B. allocation granularity, i.e. huge-page size if enabled
                 const std::size_t elementSize = sizeof(T);
                 // least common multiple (lcm) of elementSize and pageSize
                 std::size_t lcmValue = elementSize * pageSize / std::gcd(elementSize, pageSize);
@@ -233,16 +703,17 @@ class circular_buffer
             }
         }
 #else
-        static std::size_t align_with_page_size(const std::size_t min_size, bool) {
+        static std::size_t align_with_page_size(const std::size_t min_size, const double_mapped_memory_resource*) {
             return min_size; // mmap() & getpagesize() not supported for non-POSIX OS
         }
 #endif
 
-        static std::size_t buffer_size(const std::size_t size, bool _is_mmap_allocated) {
+        static std::size_t buffer_size(const std::size_t size, bool is_unmirrored) {
             // double-mmaped behaviour requires the different size/alloc strategy
             // i.e. the second buffer half may not default-constructed as it's identical to the first one
             // and would result in a double dealloc during the default destruction
-            return _is_mmap_allocated ? size : 2 * size;
+            // N.B. the split (two-span) mode does not need the mirrored second half at all
+            return is_unmirrored ? size : 2 * size;
         }
     };
 
@@ -252,8 +723,11 @@ class circular_buffer
 
         BufferTypeLocal             _buffer; // controls buffer life-cycle, the rest are cache optimisations
         bool                        _is_mmap_allocated;
+        bool                        _is_split;
         std::size_t                   _size;
-        ClaimType*                  _claim_strategy;
+        typename WriterClaimType::type _claim_strategy; // N.B. producer-local for 'ProducerType::MultiBatched'
+        OverflowPolicy              _overflow_policy;
+        std::size_t                 _n_dropped = 0;
 
     class ReservedOutputRange {
         buffer_writer<U>* _parent = nullptr;
@@ -262,6 +736,14 @@ class circular_buffer
         signed_index_type      _offset = 0;
         bool              _published_data = false;
         std::span<T>      _internal_span{};
+        std::span<T>      _wrapped_span{}; // split mode only: remainder past the wrap-around point
+
+        constexpr std::size_t wrap(std::size_t index) const noexcept { return _parent->_is_split && index >= _parent->_size ? index - _parent->_size : index; }
+        // write target of unclaimed slots, i.e. their samples are discarded rather than overwriting the buffer's content
+        static T& discarded() noexcept {
+            static thread_local T sample{};
+            return sample;
+        }
     public:
     using element_type = T;
     using value_type = typename std::remove_cv_t<T>;
@@ -269,9 +751,14 @@ class circular_buffer
     using reverse_iterator = typename std::span<T>::reverse_iterator;
     using pointer = typename std::span<T>::reverse_iterator;
 
-    explicit ReservedOutputRange(buffer_writer<U>* parent) noexcept : _parent(parent) {};
+    // detached (empty) range, e.g. of a dropped (drop-newest) or failed non-blocking reservation: writes and publishing are no-ops
+    ReservedOutputRange() noexcept = default;
     explicit constexpr ReservedOutputRange(buffer_writer<U>* parent, std::size_t index, signed_index_type sequence, std::size_t n_slots_to_claim) noexcept :
-        _parent(parent), _index(index), _n_slots_to_claim(n_slots_to_claim), _offset(sequence - static_cast<signed_index_type>(n_slots_to_claim)), _internal_span({ &_parent->_buffer->_data[_index], _n_slots_to_claim }) { }
+        _parent(parent), _index(index), _n_slots_to_claim(n_slots_to_claim), _offset(sequence - static_cast<signed_index_type>(n_slots_to_claim)) {
+        const std::size_t nFirst = _parent->_is_split ? std::min(_parent->_size - _index, _n_slots_to_claim) : _n_slots_to_claim;
+        _internal_span = { &_parent->_buffer->_data[_index], nFirst };
+        _wrapped_span  = { _parent->_buffer->_data.data(), _n_slots_to_claim - nFirst };
+    }
     ReservedOutputRange(const ReservedOutputRange&) = delete;
     ReservedOutputRange& operator=(const ReservedOutputRange&) = delete;
     explicit ReservedOutputRange(ReservedOutputRange&& other) noexcept
@@ -280,7 +767,8 @@ class circular_buffer
         , _n_slots_to_claim(std::exchange(other._n_slots_to_claim, 0))
         , _offset(std::exchange(other._offset, 0))
         , _published_data(std::exchange(other._published_data, 0))
-        , _internal_span(std::exchange(other._internal_span, std::span<T>{})) {
+        , _internal_span(std::exchange(other._internal_span, std::span<T>{}))
+        , _wrapped_span(std::exchange(other._wrapped_span, std::span<T>{})) {
     };
     ReservedOutputRange& operator=(ReservedOutputRange&& other) noexcept {
         auto tmp = std::move(other);
@@ -290,6 +778,7 @@ class circular_buffer
         std::swap(_offset, tmp._offset);
         std::swap(_published_data, tmp._published_data);
         std::swap(_internal_span, tmp._internal_span);
+        std::swap(_wrapped_span, tmp._wrapped_span);
         return *this;
     };
     ~ReservedOutputRange() {
@@ -316,14 +805,20 @@ class circular_buffer
     constexpr reverse_iterator rend() const noexcept { return _internal_span.rend(); }
     constexpr T* data() const noexcept { return _internal_span.data(); }
 
-    T& operator [](std::size_t i) const noexcept  {return _parent->_buffer->_data[_index + i]; }
-    T& operator [](std::size_t i) noexcept { return _parent->_buffer->_data[_index + i]; }
+    T& operator [](std::size_t i) const noexcept  { return _n_slots_to_claim == 0 ? discarded() : _parent->_buffer->_data[wrap(_index + i)]; }
+    T& operator [](std::size_t i) noexcept { return _n_slots_to_claim == 0 ? discarded() : _parent->_buffer->_data[wrap(_index + i)]; }
+    // N.B. in split mode the contiguous span covers only the samples up to the wrap-around point, see 'spans()'
     operator std::span<T>&() const noexcept { return _internal_span; }
     operator std::span<T>&() noexcept { return _internal_span; }
+    // (at most) two contiguous spans before and after the wrap-around point, the second is always empty for mirrored buffers
+    constexpr std::array<std::span<T>, 2> spans() const noexcept { return { _internal_span, _wrapped_span }; }
 
     constexpr void publish(std::size_t n_produced) noexcept {
+        if (_n_slots_to_claim == 0) {
+            return; // N.B. nothing (left) claimed, i.e. the cursor must not move
+        }
         assert(n_produced <= _n_slots_to_claim && "n_produced must be <= than claimed slots");
-        if (!_parent->_is_mmap_allocated) {
+        if (!_parent->_is_mmap_allocated && !_parent->_is_split) {
             const std::size_t size = _parent->_size;
             // mirror samples below/above the buffer's wrap-around point
             const size_t nFirstHalf = std::min(size - _index, n_produced);
@@ -333,7 +828,7 @@ class circular_buffer
             std::copy(&data[_index], &data[_index + nFirstHalf], &data[_index + size]);
             std::copy(&data[size], &data[size + nSecondHalf], &data[0]);
         }
-        _parent->_claim_strategy->publish(_offset + static_cast<signed_index_type>(n_produced));
+        _parent->_claim_strategy->publish(_offset + static_cast<signed_index_type>(n_produced), n_produced);
         _n_slots_to_claim -= n_produced;
         _published_data = true;
     }
@@ -342,18 +837,24 @@ class circular_buffer
     public:
         buffer_writer() = delete;
         explicit buffer_writer(std::shared_ptr<buffer_impl> buffer) noexcept :
-            _buffer(std::move(buffer)), _is_mmap_allocated(_buffer->_is_mmap_allocated),
-            _size(_buffer->_size), _claim_strategy(std::addressof(_buffer->_claim_strategy)) { };
+            _buffer(std::move(buffer)), _is_mmap_allocated(_buffer->_is_mmap_allocated), _is_split(_buffer->_is_split),
+            _size(_buffer->_size), _claim_strategy(WriterClaimType::create(_buffer->_claim_strategy)), _overflow_policy(_buffer->_overflow_policy) { };
         buffer_writer(buffer_writer&& other) noexcept
             : _buffer(std::move(other._buffer))
             , _is_mmap_allocated(_buffer->_is_mmap_allocated)
+            , _is_split(_buffer->_is_split)
             , _size(_buffer->_size)
-            , _claim_strategy(std::addressof(_buffer->_claim_strategy)) { };
+            , _claim_strategy(std::move(other._claim_strategy))
+            , _overflow_policy(_buffer->_overflow_policy)
+            , _n_dropped(other._n_dropped) { };
         buffer_writer& operator=(buffer_writer tmp) noexcept {
             std::swap(_buffer, tmp._buffer);
+            std::swap(_claim_strategy, tmp._claim_strategy);
+            std::swap(_n_dropped, tmp._n_dropped);
             _is_mmap_allocated = _buffer->_is_mmap_allocated;
+            _is_split = _buffer->_is_split;
             _size = _buffer->_size;
-            _claim_strategy = std::addressof(_buffer->_claim_strategy);
+            _overflow_policy = _buffer->_overflow_policy;
 
             return *this;
         }
@@ -361,58 +862,189 @@ class circular_buffer
         [[nodiscard]] constexpr BufferType buffer() const noexcept { return circular_buffer(_buffer); };
 
         [[nodiscard]] constexpr auto reserve_output_range(std::size_t n_slots_to_claim) noexcept -> ReservedOutputRange {
-            try {
-                const auto sequence = _claim_strategy->next(*_buffer->_read_indices, n_slots_to_claim); // alt: try_next
-                const std::size_t index = (static_cast<std::size_t>(sequence) + _size - n_slots_to_claim) % _size;
-                return ReservedOutputRange(this, index, sequence, n_slots_to_claim);
-            } catch (const NoCapacityException &) {
-                return ReservedOutputRange(this);
+            if (!make_room(n_slots_to_claim)) {
+                return ReservedOutputRange(); // drop-newest: the caller's samples are discarded
             }
+            const auto sequence = _claim_strategy->next(_buffer->_read_indices, n_slots_to_claim); // blocks until the readers freed enough space
+            const std::size_t index = (static_cast<std::size_t>(sequence) + _size - n_slots_to_claim) % _size;
+            return ReservedOutputRange(this, index, sequence, n_slots_to_claim);
+        }
+
+        // non-blocking variant of 'reserve_output_range(..)': returns an empty range if there is not enough space
+        [[nodiscard]] constexpr auto try_reserve_output_range(std::size_t n_slots_to_claim) noexcept -> ReservedOutputRange {
+            if (n_slots_to_claim == 0) {
+                return ReservedOutputRange();
+            }
+            if (_overflow_policy == OverflowPolicy::DropOldest) {
+                std::ignore = make_room(n_slots_to_claim);
+            }
+            const auto sequence = _claim_strategy->tryNext(_buffer->_read_indices, n_slots_to_claim);
+            if (!sequence) {
+                return ReservedOutputRange();
+            }
+            const std::size_t index = (static_cast<std::size_t>(*sequence) + _size - n_slots_to_claim) % _size;
+            return ReservedOutputRange(this, index, *sequence, n_slots_to_claim);
         }
 
         template <typename... Args, WriterCallback<U, Args...> Translator>
         constexpr void publish(Translator&& translator, std::size_t n_slots_to_claim = 1, Args&&... args) {
-            if (n_slots_to_claim <= 0 || _buffer->_read_indices->empty()) {
+            if (n_slots_to_claim <= 0 || !has_readers() || !make_room(n_slots_to_claim)) {
                 return;
             }
-            const auto sequence = _claim_strategy->next(*_buffer->_read_indices, n_slots_to_claim);
+            const auto sequence = _claim_strategy->next(_buffer->_read_indices, n_slots_to_claim);
             translate_and_publish(std::forward<Translator>(translator), n_slots_to_claim, sequence, std::forward<Args>(args)...);
         } // blocks until elements are available
 
         template <typename... Args, WriterCallback<U, Args...> Translator>
         constexpr bool try_publish(Translator&& translator, std::size_t n_slots_to_claim = 1, Args&&... args) {
-            if (n_slots_to_claim <= 0 || _buffer->_read_indices->empty()) {
+            if (n_slots_to_claim <= 0 || !has_readers()) {
                 return true;
             }
-            try {
-                const auto sequence = _claim_strategy->tryNext(*_buffer->_read_indices, n_slots_to_claim);
-                translate_and_publish(std::forward<Translator>(translator), n_slots_to_claim, sequence, std::forward<Args>(args)...);
-                return true;
-            } catch (const NoCapacityException &) {
+            if (_overflow_policy == OverflowPolicy::DropOldest) {
+                std::ignore = make_room(n_slots_to_claim);
+            }
+            const auto sequence = _claim_strategy->tryNext(_buffer->_read_indices, n_slots_to_claim);
+            if (!sequence) {
                 return false;
             }
+            translate_and_publish(std::forward<Translator>(translator), n_slots_to_claim, *sequence, std::forward<Args>(args)...);
+            return true;
         }
 
         [[nodiscard]] constexpr signed_index_type position() const noexcept { return _buffer->_cursor.value(); }
 
         [[nodiscard]] constexpr std::size_t available() const noexcept {
-            return static_cast<std::size_t>(_claim_strategy->getRemainingCapacity(*_buffer->_read_indices));
+            if (_overflow_policy == OverflowPolicy::DropOldest) {
+                return _size; // N.B. the writer never waits, it overwrites the oldest samples instead
+            }
+            return static_cast<std::size_t>(_claim_strategy->getRemainingCapacity(_buffer->_read_indices));
+        }
+
+        [[nodiscard]] constexpr OverflowPolicy overflow_policy() const noexcept { return _overflow_policy; }
+
+        // batched multi-producer: releases the not yet claimed rest of the writer's locally reserved block (no-op otherwise)
+        void flush() noexcept {
+            if constexpr (producer_type == ProducerType::MultiBatched) {
+                _claim_strategy->flush();
+            }
+        }
+
+        // number of samples discarded by the overflow policy since the writer's creation
+        [[nodiscard]] constexpr std::size_t n_dropped() const noexcept { return _n_dropped; }
+
+        /**
+         * online resize: replaces the buffer by a new one of at least 'min_size' samples, the not yet consumed samples (incl.
+         * the readers' look-back) are copied and keep their sequence numbers, i.e. the reader positions remain valid.
+         * Readers follow the new buffer on their next access, the old one is released once all of them did so.
+         * Drop-oldest buffers keep only the newest samples if the unconsumed ones do not fit.
+         *
+         * N.B. single-producer only and not to be called while an output range is reserved, i.e. at a safe point of the writer
+         * @throws std::length_error if the unconsumed samples do not fit into the new buffer
+         */
+        void resize(const std::size_t min_size) requires (producer_type == ProducerType::Single) {
+            auto successor = std::make_shared<buffer_impl>(min_size, _buffer->_allocator, _is_split ? WrapMode::Split : WrapMode::Mirrored, _overflow_policy);
+            if (_buffer->_memory_locked) {
+                std::ignore = successor->lock_memory(); // N.B. best effort, like the original lock
+            }
+            const std::size_t newSize = successor->_size;
+            const signed_index_type cursor = _buffer->_cursor.value();
+            signed_index_type oldest = std::min(_buffer->_read_indices.getMinimum(cursor), cursor);
+            if (static_cast<std::size_t>(cursor - oldest) > newSize) {
+                if (_overflow_policy != OverflowPolicy::DropOldest) {
+                    throw std::length_error(fmt::format("circular_buffer::resize({}) - {} unconsumed samples exceed the new size {}", min_size, cursor - oldest, newSize));
+                }
+                oldest = cursor - static_cast<signed_index_type>(newSize);
+            }
+
+            auto &from = _buffer->_data;
+            auto &to = successor->_data;
+            const bool mirrored = !successor->_is_mmap_allocated && !successor->_is_split;
+            for (signed_index_type sequence = oldest; sequence < cursor; sequence++) {
+                const std::size_t index = static_cast<std::size_t>(sequence) & (newSize - 1);
+                to[index] = from[static_cast<std::size_t>(sequence) & (_size - 1)];
+                if (mirrored) {
+                    to[index + newSize] = to[index];
+                }
+            }
+            successor->_claim_strategy.publish(cursor); // N.B. continue with the same sequence numbers
+
+            {
+                std::scoped_lock lock(_buffer->_handover_mutex);
+                _buffer->_read_indices.forEachClaimed([this, &successor, oldest](const void *id, signed_index_type value) {
+                    auto slot = successor->_read_indices.add(successor->_cursor);
+                    slot.setValue(std::max(value, oldest));
+                    _buffer->_handover_slots.emplace(id, std::move(slot));
+                });
+                _buffer->_successor_owner = successor;
+                _buffer->_successor.store(successor.get(), std::memory_order_release);
+            }
+            _buffer = std::move(successor);
+            _size = _buffer->_size;
+            _claim_strategy = WriterClaimType::create(_buffer->_claim_strategy);
+        }
+
+        // number of samples that can be written contiguously before the wrap-around point (split mode), unlimited otherwise
+        // N.B. exact only for single-producer buffers
+        [[nodiscard]] constexpr std::size_t samples_to_wrap() const noexcept {
+            if (!_is_split) {
+                return std::numeric_limits<std::size_t>::max();
+            }
+            return _size - static_cast<std::size_t>(_buffer->_cursor.value()) % _size;
         }
 
         private:
+        [[nodiscard]] bool has_readers() const noexcept {
+            return !_buffer->_read_indices.empty() || _buffer->_n_monitor_readers.load(std::memory_order_relaxed) > 0;
+        }
+
+        /**
+         * applies the overflow policy prior to claiming 'n_slots_to_claim' slots (no-op for 'Block')
+         * @return false if the samples to be written are to be dropped (drop-newest)
+         */
+        [[nodiscard]] bool make_room(const std::size_t n_slots_to_claim) noexcept {
+            switch (_overflow_policy) {
+            case OverflowPolicy::Block: return true;
+            case OverflowPolicy::DropNewest:
+                if (available() >= n_slots_to_claim) {
+                    return true;
+                }
+                _n_dropped += n_slots_to_claim;
+                return false;
+            case OverflowPolicy::DropOldest: {
+                const signed_index_type wrapPoint = _buffer->_cursor.value() + static_cast<signed_index_type>(n_slots_to_claim) - static_cast<signed_index_type>(_size);
+                if (const signed_index_type minSequence = _buffer->_read_indices.getMinimum(); wrapPoint > minSequence) {
+                    _n_dropped += static_cast<std::size_t>(wrapPoint - minSequence);
+                    _buffer->_read_indices.advanceTo(wrapPoint);
+                }
+                return true;
+            }
+            }
+            return true;
+        }
+
         template <typename... Args, WriterCallback<U, Args...> Translator>
         constexpr void translate_and_publish(Translator&& translator, const std::size_t n_slots_to_claim, const signed_index_type publishSequence, const Args&... args) {
             try {
                 auto& data = _buffer->_data;
                 const std::size_t index = (static_cast<std::size_t>(publishSequence) + _size - n_slots_to_claim) % _size;
-                std::span<U> writable_data(&data[index], n_slots_to_claim);
-                if constexpr (std::is_invocable<Translator, std::span<T>&, signed_index_type, Args...>::value) {
-                    std::invoke(std::forward<Translator>(translator), std::forward<std::span<T>&>(writable_data), publishSequence - static_cast<signed_index_type>(n_slots_to_claim), args...);
+                const auto invoke_translator = [&translator, &args...](std::span<U> writable_data, signed_index_type writePosition) {
+                    if constexpr (std::is_invocable<Translator, std::span<T>&, signed_index_type, Args...>::value) {
+                        std::invoke(translator, writable_data, writePosition, args...);
+                    } else {
+                        std::invoke(translator, writable_data, args...);
+                    }
+                };
+                const signed_index_type writePosition = publishSequence - static_cast<signed_index_type>(n_slots_to_claim);
+                if (_is_split && index + n_slots_to_claim > _size) {
+                    // split mode: no mirror, the translator is invoked once per contiguous span before/after the wrap-around point
+                    const std::size_t nFirst = _size - index;
+                    invoke_translator(std::span<U>(&data[index], nFirst), writePosition);
+                    invoke_translator(std::span<U>(data.data(), n_slots_to_claim - nFirst), writePosition + static_cast<signed_index_type>(nFirst));
                 } else {
-                    std::invoke(std::forward<Translator>(translator), std::forward<std::span<T>&>(writable_data), args...);
+                    invoke_translator(std::span<U>(&data[index], n_slots_to_claim), writePosition);
                 }
 
-                if (!_is_mmap_allocated) {
+                if (!_is_mmap_allocated && !_is_split) {
                     // mirror samples below/above the buffer's wrap-around point
                     const size_t nFirstHalf = std::min(_size - index, n_slots_to_claim);
                     const size_t nSecondHalf = n_slots_to_claim  - nFirstHalf;
@@ -420,7 +1052,7 @@ class circular_buffer
                     std::copy(&data[index], &data[index + nFirstHalf], &data[index+ _size]);
                     std::copy(&data[_size],  &data[_size + nSecondHalf], &data[0]);
                 }
-                _claim_strategy->publish(publishSequence); // points at first non-writable index
+                _claim_strategy->publish(publishSequence, n_slots_to_claim); // points at first non-writable index
             } catch (const std::exception&) {
                 throw;
             } catch (...) {
@@ -434,10 +1066,17 @@ class circular_buffer
     {
         using BufferTypeLocal = std::shared_ptr<buffer_impl>;
 
-        std::shared_ptr<Sequence>   _read_index = std::make_shared<Sequence>();
-        signed_index_type                _read_index_cached;
-        BufferTypeLocal             _buffer; // controls buffer life-cycle, the rest are cache optimisations
-        std::size_t                   _size; // pre-condition: std::has_single_bit(_size)
+        mutable SequenceTable::Slot _read_index; // N.B. empty for monitor readers, mutable: readers may skip gaps on (const) access
+        mutable signed_index_type        _read_index_cached; // mutable: monitor readers may skip forward on (const) access
+        mutable BufferTypeLocal     _buffer; // controls buffer life-cycle, the rest are cache optimisations, mutable: see 'follow_resize()'
+        mutable std::size_t         _size; // pre-condition: std::has_single_bit(_size)
+        mutable bool                _is_split;
+        bool                        _is_monitor = false;
+        bool                        _is_overwritable = false; // drop-oldest buffer: the writer may move the read index forward
+        signed_index_type           _n_history = 0; // look-back: already consumed samples kept readable, i.e. the slot gates at 'position - _n_history'
+        mutable std::size_t         _n_dropped  = 0;
+        mutable signed_index_type   _published_cached = kInitialCursorValue; // multi-producer only: highest contiguously published sequence seen so far
+        mutable signed_index_type   _gap_free_cached  = kInitialCursorValue; // batched multi-producer only: highest published sequence w/o preceding gap
 
         std::size_t
         buffer_index() const noexcept {
@@ -445,65 +1084,242 @@ class circular_buffer
             return static_cast<std::size_t>(_read_index_cached) & bitmask;
         }
 
+        // highest sequence that can be read: the cursor for single producers, the highest contiguously published sequence for
+        // multiple producers since their cursor already advances when slots are claimed
+        [[nodiscard]] signed_index_type published_sequence() const noexcept {
+            const signed_index_type cursor = _buffer->_cursor.value();
+            if constexpr (producer_type != ProducerType::Single) {
+                const auto &claim = _buffer->_claim_strategy;
+                // N.B. the scan resumes where the last one stopped
+                _published_cached = claim.getHighestPublishedSequence(std::max(_read_index_cached, _published_cached) + 1, cursor);
+                if constexpr (producer_type == ProducerType::MultiBatched) {
+                    // skip the gaps (unused tails of the producers' blocks) at the read position until reaching published samples,
+                    // N.B. rescans after each skip since further gaps may have been published behind the skipped one meanwhile
+                    while (_read_index_cached < _published_cached && claim.isGap(_read_index_cached + 1)) {
+                        advance(static_cast<std::size_t>(claim.gapEnd(_read_index_cached + 1, _published_cached) - _read_index_cached));
+                        _published_cached = claim.getHighestPublishedSequence(std::max(_read_index_cached, _published_cached) + 1, _buffer->_cursor.value());
+                    }
+                    const signed_index_type gapLowerBound = std::max(_read_index_cached, _gap_free_cached) + 1;
+                    _gap_free_cached = claim.firstGap(gapLowerBound, _published_cached) - 1;
+                    return _gap_free_cached;
+                }
+                return _published_cached;
+            } else {
+                return cursor;
+            }
+        }
+
+        // monitor readers: skip forward if the writer lapped the reader by more than half the buffer
+        // drop-oldest buffers: follow the read index if it has been moved forward by the writer
+        // moves the read position forward, used by 'consume(..)' and to skip gaps of batched multi-producer buffers
+        void advance(const std::size_t n_elements) const noexcept {
+            if (_is_monitor) {
+                const signed_index_type readStart = std::exchange(_read_index_cached, _read_index_cached + static_cast<signed_index_type>(n_elements));
+                if (const signed_index_type overwritten = _buffer->_cursor.value() - static_cast<signed_index_type>(_size) - readStart; overwritten > 0) {
+                    _n_dropped += std::min(static_cast<std::size_t>(overwritten), n_elements); // writer overran the samples while they were being read
+                }
+                return;
+            }
+            if (_is_overwritable) {
+                // N.B. the writer may have moved the read index forward while the samples were being read
+                const signed_index_type next = _read_index_cached + static_cast<signed_index_type>(n_elements);
+                signed_index_type current = _read_index_cached;
+                while (current < next && !_read_index.compareAndSet(current - _n_history, next - _n_history)) {
+                    current = _read_index.value() + _n_history;
+                }
+                _n_dropped += static_cast<std::size_t>(current - _read_index_cached);
+                _read_index_cached = std::max(current, next);
+                return;
+            }
+            _read_index_cached = _read_index.addAndGet(static_cast<signed_index_type>(n_elements)) + _n_history;
+        }
+
+        // online resize: moves to the buffer(s) that replaced the current one and takes over the gating slot claimed there
+        void follow_resize() const noexcept {
+            if (_buffer->_successor.load(std::memory_order_acquire) == nullptr) [[likely]] {
+                return;
+            }
+            while (_buffer->_successor.load(std::memory_order_acquire) != nullptr) {
+                std::shared_ptr<buffer_impl> successor;
+                {
+                    std::scoped_lock lock(_buffer->_handover_mutex);
+                    successor = _buffer->_successor_owner;
+                    if (_read_index) {
+                        const signed_index_type value = _read_index.value();
+                        if (auto it = _buffer->_handover_slots.find(_read_index.id()); it != _buffer->_handover_slots.end()) {
+                            SequenceTable::Slot slot = std::move(it->second);
+                            _buffer->_handover_slots.erase(it);
+                            // N.B. the reader may have consumed further while the buffer was being resized
+                            for (signed_index_type current = slot.value(); current < value && !slot.compareAndSet(current, value); current = slot.value()) { }
+                            _buffer->_read_indices.remove(_read_index);
+                            _read_index = std::move(slot);
+                        } else { // reader created on the old buffer after it has been resized
+                            SequenceTable::Slot slot = successor->_read_indices.add(successor->_cursor);
+                            slot.setValue(value);
+                            _buffer->_read_indices.remove(_read_index);
+                            _read_index = std::move(slot);
+                        }
+                    }
+                }
+                if (_is_monitor) {
+                    successor->_n_monitor_readers.fetch_add(1, std::memory_order_relaxed);
+                    _buffer->_n_monitor_readers.fetch_sub(1, std::memory_order_relaxed);
+                }
+                _buffer = std::move(successor);
+                _size = _buffer->_size;
+                _is_split = _buffer->_is_split;
+            }
+        }
+
+        void skip_if_overrun() const noexcept {
+            signed_index_type latest = _read_index_cached;
+            if (_is_monitor) {
+                latest = _buffer->_cursor.value() - static_cast<signed_index_type>(_size / 2);
+            } else if (_is_overwritable) {
+                latest = _read_index.value() + _n_history;
+            }
+            if (latest > _read_index_cached) {
+                _n_dropped += static_cast<std::size_t>(latest - _read_index_cached);
+                _read_index_cached = latest;
+            }
+        }
+
     public:
         buffer_reader() = delete;
-        buffer_reader(std::shared_ptr<buffer_impl> buffer) noexcept :
-            _buffer(buffer), _size(buffer->_size) {
-            gr::detail::addSequences(_buffer->_read_indices, _buffer->_cursor, {_read_index});
-            _read_index_cached = _read_index->value();
+        buffer_reader(std::shared_ptr<buffer_impl> buffer, ReaderMode mode = ReaderMode::Gating, std::size_t n_history = 0) noexcept :
+            _buffer(buffer), _size(buffer->_size), _is_split(buffer->_is_split), _is_monitor(mode == ReaderMode::Monitor),
+            _is_overwritable(!_is_monitor && buffer->_overflow_policy == OverflowPolicy::DropOldest), _n_history(static_cast<signed_index_type>(n_history)) {
+            assert(n_history < _size && "look-back must be smaller than the buffer size");
+            assert((n_history == 0 || !_is_split) && "look-back requires contiguous (mirrored or double-mapped) storage");
+            if (_is_monitor) {
+                _buffer->_n_monitor_readers.fetch_add(1, std::memory_order_relaxed);
+                _read_index_cached = _buffer->_cursor.value();
+            } else {
+                _read_index = _buffer->_read_indices.add(_buffer->_cursor);
+                _read_index_cached = _read_index.value();
+                // N.B. the samples preceding the first read position are the buffer's initial (value-initialised) content
+                _read_index.setValue(_read_index_cached - _n_history);
+            }
+            _published_cached = _read_index_cached;
+            _gap_free_cached  = _read_index_cached;
         }
         buffer_reader(buffer_reader&& other) noexcept
             : _read_index(std::move(other._read_index))
-            , _read_index_cached(std::exchange(other._read_index_cached, _read_index->value()))
+            , _read_index_cached(other._read_index_cached)
             , _buffer(other._buffer)
-            , _size(_buffer->_size) {
+            , _size(_buffer->_size)
+            , _is_split(_buffer->_is_split)
+            , _is_monitor(std::exchange(other._is_monitor, false)) // N.B. moved-from readers hold neither a slot nor a monitor registration
+            , _is_overwritable(other._is_overwritable)
+            , _n_history(other._n_history)
+            , _n_dropped(other._n_dropped)
+            , _published_cached(other._published_cached)
+            , _gap_free_cached(other._gap_free_cached) {
         }
         buffer_reader& operator=(buffer_reader tmp) noexcept {
             std::swap(_read_index, tmp._read_index);
             std::swap(_read_index_cached, tmp._read_index_cached);
             std::swap(_buffer, tmp._buffer);
+            std::swap(_is_monitor, tmp._is_monitor);
+            std::swap(_is_overwritable, tmp._is_overwritable);
+            std::swap(_n_history, tmp._n_history);
+            std::swap(_n_dropped, tmp._n_dropped);
+            std::swap(_published_cached, tmp._published_cached);
+            std::swap(_gap_free_cached, tmp._gap_free_cached);
             _size = _buffer->_size;
+            _is_split = _buffer->_is_split;
             return *this;
         };
-        ~buffer_reader() { gr::detail::removeSequence( _buffer->_read_indices, _read_index); }
+        ~buffer_reader() {
+            follow_resize(); // N.B. releases the slot claimed on the reader's behalf in the new buffer
+            if (_is_monitor) {
+                _buffer->_n_monitor_readers.fetch_sub(1, std::memory_order_relaxed);
+            } else {
+                _buffer->_read_indices.remove(_read_index);
+            }
+        }
 
-        [[nodiscard]] constexpr BufferType buffer() const noexcept { return circular_buffer(_buffer); };
+        [[nodiscard]] constexpr BufferType buffer() const noexcept { follow_resize(); return circular_buffer(_buffer); };
 
+        // N.B. in split mode the returned span is limited to the samples up to the wrap-around point, see 'get_spans(..)'
         template <bool strict_check = true>
         [[nodiscard]] constexpr std::span<const U> get(const std::size_t n_requested = 0) const noexcept {
+            follow_resize();
             const auto& data = _buffer->_data;
+            skip_if_overrun();
             if constexpr (strict_check) {
                 const std::size_t n = n_requested > 0 ? std::min(n_requested, available()) : available();
-                return { &data[buffer_index()], n };
+                return { &data[buffer_index()], std::min(n, samples_to_wrap()) };
             }
             const std::size_t n = n_requested > 0 ? n_requested : available();
-            return { &data[buffer_index()], n };
+            return { &data[buffer_index()], std::min(n, samples_to_wrap()) };
+        }
+
+        // (at most) two contiguous spans before and after the wrap-around point, the second is always empty for mirrored buffers
+        [[nodiscard]] constexpr std::array<std::span<const U>, 2> get_spans(const std::size_t n_requested = 0) const noexcept {
+            follow_resize();
+            const auto& data = _buffer->_data;
+            skip_if_overrun();
+            const std::size_t n = n_requested > 0 ? std::min(n_requested, available()) : available();
+            const std::size_t nFirst = std::min(n, samples_to_wrap());
+            return { std::span<const U>(&data[buffer_index()], nFirst), std::span<const U>(data.data(), n - nFirst) };
+        }
+
+        /**
+         * look-back access: like 'get(..)' but the span starts 'n_history()' already consumed samples before the first
+         * unconsumed one, i.e. '[0, n_history())' is the history and '[n_history(), size())' the (up to) 'n_requested' new samples
+         */
+        [[nodiscard]] constexpr std::span<const U> get_history(const std::size_t n_requested = 0) const noexcept {
+            follow_resize();
+            const auto& data = _buffer->_data;
+            skip_if_overrun();
+            const std::size_t n = n_requested > 0 ? std::min(n_requested, available()) : available();
+            const std::size_t index = static_cast<std::size_t>(_read_index_cached - _n_history) & (_size - 1);
+            return { &data[index], static_cast<std::size_t>(_n_history) + n };
         }
 
         template <bool strict_check = true>
         [[nodiscard]] constexpr bool consume(const std::size_t n_elements = 1) noexcept {
+            follow_resize();
             if constexpr (strict_check) {
                 if (n_elements <= 0) {
                     return true;
                 }
-                if (n_elements > available()) {
+                const signed_index_type published = published_sequence(); // N.B. may skip gaps, i.e. move '_read_index_cached'
+                if (n_elements > static_cast<std::size_t>(published - _read_index_cached)) { // N.B. w/o skipping forward
                     return false;
                 }
             }
-            _read_index_cached = _read_index->addAndGet(static_cast<signed_index_type>(n_elements));
+            advance(n_elements);
             return true;
         }
 
         [[nodiscard]] constexpr signed_index_type position() const noexcept { return _read_index_cached; }
 
         [[nodiscard]] constexpr std::size_t available() const noexcept {
-            return static_cast<std::size_t>(_buffer->_cursor.value() - _read_index_cached);
+            follow_resize();
+            skip_if_overrun();
+            const signed_index_type published = published_sequence();
+            return static_cast<std::size_t>(published - _read_index_cached);
+        }
+
+        [[nodiscard]] constexpr ReaderMode mode() const noexcept { return _is_monitor ? ReaderMode::Monitor : ReaderMode::Gating; }
+
+        // number of already consumed samples kept readable in front of the unconsumed ones, see 'get_history(..)'
+        [[nodiscard]] constexpr std::size_t n_history() const noexcept { return static_cast<std::size_t>(_n_history); }
+
+        // monitor readers and readers of drop-oldest buffers: number of samples skipped or overrun since creation, '0' otherwise
+        [[nodiscard]] constexpr std::size_t n_dropped() const noexcept { return _n_dropped; }
+
+        // number of samples that can be read contiguously before the wrap-around point (split mode), unlimited otherwise
+        [[nodiscard]] constexpr std::size_t samples_to_wrap() const noexcept {
+            return _is_split ? _size - buffer_index() : std::numeric_limits<std::size_t>::max();
         }
     };
 
     [[nodiscard]] constexpr static Allocator DefaultAllocator() {
         if constexpr (has_posix_mmap_interface) {
-            return double_mapped_memory_resource::allocator<T>();
+            return caching_double_mapped_memory_resource::allocator<T>();
         } else {
             return Allocator();
         }
@@ -514,19 +1330,41 @@ class circular_buffer
 
 public:
     circular_buffer() = delete;
-    explicit circular_buffer(std::size_t min_size, Allocator allocator = DefaultAllocator())
-        : _shared_buffer_ptr(std::make_shared<buffer_impl>(min_size, allocator)) { }
+    explicit circular_buffer(std::size_t min_size, Allocator allocator = DefaultAllocator(), WrapMode wrap_mode = WrapMode::Mirrored)
+        : _shared_buffer_ptr(std::make_shared<buffer_impl>(min_size, allocator, wrap_mode, OverflowPolicy::Block)) { }
+    /**
+     * @throws std::invalid_argument if the overflow policy is not supported by the producer type, see 'supports_overflow_policy(..)'
+     */
+    circular_buffer(std::size_t min_size, OverflowPolicy overflow_policy, Allocator allocator = DefaultAllocator(), WrapMode wrap_mode = WrapMode::Mirrored)
+        : _shared_buffer_ptr(supports_overflow_policy(overflow_policy) ? std::make_shared<buffer_impl>(min_size, allocator, wrap_mode, overflow_policy)
+                                                                       : throw std::invalid_argument("circular_buffer - drop-oldest requires a single producer")) { }
     ~circular_buffer() = default;
 
     [[nodiscard]] std::size_t       size() const noexcept { return _shared_buffer_ptr->_size; }
+    [[nodiscard]] WrapMode          wrap_mode() const noexcept { return _shared_buffer_ptr->_is_split ? WrapMode::Split : WrapMode::Mirrored; }
+    [[nodiscard]] OverflowPolicy    overflow_policy() const noexcept { return _shared_buffer_ptr->_overflow_policy; }
+    // N.B. drop-oldest moves the readers relative to the writer's cursor, which is only well-defined for a single producer
+    [[nodiscard]] static constexpr bool supports_overflow_policy(OverflowPolicy overflow_policy) noexcept { return overflow_policy != OverflowPolicy::DropOldest || producer_type == ProducerType::Single; }
     [[nodiscard]] BufferWriter auto new_writer() { return buffer_writer<T>(_shared_buffer_ptr); }
-    [[nodiscard]] BufferReader auto new_reader() { return buffer_reader<T>(_shared_buffer_ptr); }
+    [[nodiscard]] BufferReader auto new_reader(ReaderMode mode = ReaderMode::Gating, std::size_t n_history = 0) { return buffer_reader<T>(_shared_buffer_ptr, mode, n_history); }
+
+    /**
+     * prefaults and pins (mlock) the buffer's memory, see 'util::lock_memory(..)'. The memory is unpinned when the buffer
+     * is released, an online resize ('buffer_writer::resize(..)') pins the new buffer as well.
+     */
+    memory_lock_result lock_memory() noexcept { return _shared_buffer_ptr->lock_memory(); }
+    [[nodiscard]] bool is_memory_locked() const noexcept { return _shared_buffer_ptr->_memory_locked; }
 
     // implementation specific interface -- not part of public Buffer / production-code API
-    [[nodiscard]] auto n_readers()              { return _shared_buffer_ptr->_read_indices->size(); }
+    [[nodiscard]] auto n_readers()              { return _shared_buffer_ptr->_read_indices.size(); } // N.B. gating readers only
+    [[nodiscard]] auto n_monitor_readers()      { return _shared_buffer_ptr->_n_monitor_readers.load(std::memory_order_relaxed); }
     [[nodiscard]] const auto &claim_strategy()  { return _shared_buffer_ptr->_claim_strategy; }
     [[nodiscard]] const auto &wait_strategy()   { return _shared_buffer_ptr->_wait_strategy; }
     [[nodiscard]] const auto &cursor_sequence() { return _shared_buffer_ptr->_cursor; }
+    [[nodiscard]] std::size_t page_size() const { // effectively obtained page size, '0' if not double-mapped
+        const auto* mmap_resource = dynamic_cast<const double_mapped_memory_resource *>(_shared_buffer_ptr->_allocator.resource());
+        return mmap_resource == nullptr ? 0LU : mmap_resource->page_size(_shared_buffer_ptr->_data.data());
+    }
 
 };
 static_assert(Buffer<circular_buffer<int32_t>>);
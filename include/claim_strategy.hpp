@@ -1,12 +1,15 @@
 #ifndef GNURADIO_CLAIM_STRATEGY_HPP
 #define GNURADIO_CLAIM_STRATEGY_HPP
 
+#include <algorithm>
+#include <atomic>
+#include <bit>
 #include <cassert>
 #include <concepts>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <span>
-#include <stdexcept>
 #include <vector>
 
 #include "sequence.hpp"
@@ -15,20 +18,16 @@
 
 namespace gr {
 
-struct NoCapacityException : public std::runtime_error {
-    NoCapacityException() : std::runtime_error("NoCapacityException"){};
-};
-
 // clang-format off
 
 template<typename T>
-concept ClaimStrategy = requires(T /*const*/ t, const std::vector<std::shared_ptr<Sequence>> &dependents, const std::size_t requiredCapacity,
+concept ClaimStrategy = requires(T /*const*/ t, const SequenceTable &dependents, const std::size_t requiredCapacity,
         const std::make_signed_t<std::size_t> cursorValue, const std::make_signed_t<std::size_t> sequence, const std::make_signed_t<std::size_t> availableSequence, const std::size_t n_slots_to_claim) {
     { t.hasAvailableCapacity(dependents, requiredCapacity, cursorValue) } -> std::same_as<bool>;
     { t.next(dependents, n_slots_to_claim) } -> std::same_as<std::make_signed_t<std::size_t>>;
-    { t.tryNext(dependents, n_slots_to_claim) } -> std::same_as<std::make_signed_t<std::size_t>>;
+    { t.tryNext(dependents, n_slots_to_claim) } -> std::same_as<std::optional<std::make_signed_t<std::size_t>>>;
     { t.getRemainingCapacity(dependents) } -> std::same_as<std::make_signed_t<std::size_t>>;
-    { t.publish(sequence) } -> std::same_as<void>;
+    { t.publish(sequence, n_slots_to_claim) } -> std::same_as<void>;
     { t.isAvailable(sequence) } -> std::same_as<bool>;
     { t.getHighestPublishedSequence(sequence, availableSequence) } -> std::same_as<std::make_signed_t<std::size_t>>;
 };
@@ -54,7 +53,7 @@ public:
     SingleThreadedStrategy(const SingleThreadedStrategy &&) = delete;
     void operator=(const SingleThreadedStrategy &) = delete;
 
-    bool hasAvailableCapacity(const std::vector<std::shared_ptr<Sequence>> &dependents, const std::size_t requiredCapacity, const signed_index_type/*cursorValue*/) const noexcept {
+    bool hasAvailableCapacity(const SequenceTable &dependents, const std::size_t requiredCapacity, const signed_index_type/*cursorValue*/) const noexcept {
         if (const signed_index_type wrapPoint = (_nextValue + static_cast<signed_index_type>(requiredCapacity)) - static_cast<signed_index_type>(_size); wrapPoint > _cachedValue || _cachedValue > _nextValue) {
             auto minSequence = detail::getMinimumSequence(dependents, _nextValue);
             _cachedValue     = minSequence;
@@ -65,7 +64,7 @@ public:
         return true;
     }
 
-    signed_index_type next(const std::vector<std::shared_ptr<Sequence>> &dependents, const std::size_t n_slots_to_claim = 1) noexcept {
+    signed_index_type next(const SequenceTable &dependents, const std::size_t n_slots_to_claim = 1) noexcept {
         assert((n_slots_to_claim > 0 && n_slots_to_claim <= _size) && "n_slots_to_claim must be > 0 and <= bufferSize");
 
         auto nextSequence = _nextValue + static_cast<signed_index_type>(n_slots_to_claim);
@@ -87,11 +86,12 @@ public:
         return nextSequence;
     }
 
-    signed_index_type tryNext(const std::vector<std::shared_ptr<Sequence>> &dependents, const std::size_t n_slots_to_claim) {
+    // N.B. returns 'std::nullopt' rather than throwing if there is not enough capacity, called at high rates under back-pressure
+    [[nodiscard]] std::optional<signed_index_type> tryNext(const SequenceTable &dependents, const std::size_t n_slots_to_claim) noexcept {
         assert((n_slots_to_claim > 0) && "n_slots_to_claim must be > 0");
 
         if (!hasAvailableCapacity(dependents, n_slots_to_claim, 0 /* unused cursor value */)) {
-            throw NoCapacityException();
+            return std::nullopt;
         }
 
         const auto nextSequence = _nextValue + static_cast<signed_index_type>(n_slots_to_claim);
@@ -100,14 +100,14 @@ public:
         return nextSequence;
     }
 
-    signed_index_type getRemainingCapacity(const std::vector<std::shared_ptr<Sequence>> &dependents) const noexcept {
+    signed_index_type getRemainingCapacity(const SequenceTable &dependents) const noexcept {
         const auto consumed = detail::getMinimumSequence(dependents, _nextValue);
         const auto produced = _nextValue;
 
         return static_cast<signed_index_type>(_size) - (produced - consumed);
     }
 
-    void publish(signed_index_type sequence) {
+    void publish(signed_index_type sequence, std::size_t /*n_slots_to_publish*/ = 1) {
         _cursor.setValue(sequence);
         _nextValue = sequence;
         if constexpr (hasSignalAllWhenBlocking<WAIT_STRATEGY>) {
@@ -125,14 +125,14 @@ template <std::size_t Size>
 struct MultiThreadedStrategySizeMembers
 {
     static constexpr std::int32_t _size = Size;
-    static constexpr std::int32_t _indexShift = std::bit_width(Size);
+    static constexpr std::int32_t _indexShift = std::countr_zero(Size); // log2(Size)
 };
 
 template <>
 struct MultiThreadedStrategySizeMembers<std::dynamic_extent>
 {
     explicit MultiThreadedStrategySizeMembers(std::size_t size)
-    : _size(static_cast<std::int32_t>(size)), _indexShift(static_cast<std::int32_t>(std::bit_width(size)))
+    : _size(static_cast<std::int32_t>(size)), _indexShift(std::countr_zero(size))
     {}
 
     const std::int32_t _size;
@@ -146,14 +146,20 @@ struct MultiThreadedStrategySizeMembers<std::dynamic_extent>
  * to determine the highest available sequence that can be read, then getHighestPublishedSequence should be used.
  *
  * The size argument (compile-time and run-time) must be a power-of-2 value.
+ *
+ * The publication state is tracked with one bit per slot (i.e. 128 kiB for 1M slots) whose expected value toggles with
+ * each wrap-around (round) of the sequence: slot 'i' is published for 'sequence' if its bit equals the round parity
+ * '(sequence >> log2(size)) & 1'. Producers publish their claimed ranges with word-wise atomic 'fetch_or'/'fetch_and',
+ * readers find the highest contiguously published sequence by scanning 64 slots per step ('std::countr_one').
  */
 template<std::size_t SIZE = std::dynamic_extent, WaitStrategy WAIT_STRATEGY = BusySpinWaitStrategy>
 requires (SIZE == std::dynamic_extent or std::has_single_bit(SIZE))
 class alignas(hardware_constructive_interference_size) MultiThreadedStrategy
 : private MultiThreadedStrategySizeMembers<SIZE> {
+protected:
     Sequence &_cursor;
     WAIT_STRATEGY &_waitStrategy;
-    std::vector<std::int32_t> _availableBuffer; // tracks the state of each ringbuffer slot
+    std::vector<std::atomic<std::uint64_t>> _availableBits; // one bit per ringbuffer slot, see 'isAvailable(..)'
     std::shared_ptr<Sequence> _gatingSequenceCache = std::make_shared<Sequence>();
     using MultiThreadedStrategySizeMembers<SIZE>::_size;
     using MultiThreadedStrategySizeMembers<SIZE>::_indexShift;
@@ -164,21 +170,23 @@ public:
 
     explicit
     MultiThreadedStrategy(Sequence &cursor, WAIT_STRATEGY &waitStrategy) requires (SIZE != std::dynamic_extent)
-    : _cursor(cursor), _waitStrategy(waitStrategy), _availableBuffer(SIZE, -1) {
+    : _cursor(cursor), _waitStrategy(waitStrategy), _availableBits(wordCount(SIZE)) {
+        initialiseAvailableBits();
     }
 
     explicit
     MultiThreadedStrategy(Sequence &cursor, WAIT_STRATEGY &waitStrategy, std::size_t buffer_size)
     requires (SIZE == std::dynamic_extent)
     : MultiThreadedStrategySizeMembers<SIZE>(buffer_size),
-      _cursor(cursor), _waitStrategy(waitStrategy), _availableBuffer(buffer_size, -1) {
+      _cursor(cursor), _waitStrategy(waitStrategy), _availableBits(wordCount(buffer_size)) {
+        initialiseAvailableBits();
     }
 
     MultiThreadedStrategy(const MultiThreadedStrategy &)  = delete;
     MultiThreadedStrategy(const MultiThreadedStrategy &&) = delete;
     void               operator=(const MultiThreadedStrategy &) = delete;
 
-    [[nodiscard]] bool hasAvailableCapacity(const std::vector<std::shared_ptr<Sequence>> &dependents, const std::size_t requiredCapacity, const signed_index_type cursorValue) const noexcept {
+    [[nodiscard]] bool hasAvailableCapacity(const SequenceTable &dependents, const std::size_t requiredCapacity, const signed_index_type cursorValue) const noexcept {
         const auto wrapPoint = (cursorValue + static_cast<signed_index_type>(requiredCapacity)) - static_cast<signed_index_type>(_size);
 
         if (const auto cachedGatingSequence = _gatingSequenceCache->value(); wrapPoint > cachedGatingSequence || cachedGatingSequence > cursorValue) {
@@ -192,7 +200,7 @@ public:
         return true;
     }
 
-    [[nodiscard]] signed_index_type next(const std::vector<std::shared_ptr<Sequence>> &dependents, std::size_t n_slots_to_claim = 1) {
+    [[nodiscard]] signed_index_type next(const SequenceTable &dependents, std::size_t n_slots_to_claim = 1) {
         assert((n_slots_to_claim > 0) && "n_slots_to_claim must be > 0");
 
         signed_index_type current;
@@ -226,7 +234,8 @@ public:
         return next;
     }
 
-    [[nodiscard]] signed_index_type tryNext(const std::vector<std::shared_ptr<Sequence>> &dependents, std::size_t n_slots_to_claim = 1) {
+    // N.B. returns 'std::nullopt' rather than throwing if there is not enough capacity, called at high rates under back-pressure
+    [[nodiscard]] std::optional<signed_index_type> tryNext(const SequenceTable &dependents, std::size_t n_slots_to_claim = 1) noexcept {
         assert((n_slots_to_claim > 0) && "n_slots_to_claim must be > 0");
 
         signed_index_type current;
@@ -237,22 +246,23 @@ public:
             next    = current + static_cast<signed_index_type>(n_slots_to_claim);
 
             if (!hasAvailableCapacity(dependents, n_slots_to_claim, current)) {
-                throw NoCapacityException();
+                return std::nullopt;
             }
         } while (!_cursor.compareAndSet(current, next));
 
         return next;
     }
 
-    [[nodiscard]] signed_index_type getRemainingCapacity(const std::vector<std::shared_ptr<Sequence>> &dependents) const noexcept {
+    [[nodiscard]] signed_index_type getRemainingCapacity(const SequenceTable &dependents) const noexcept {
         const auto produced = _cursor.value();
         const auto consumed = detail::getMinimumSequence(dependents, produced);
 
         return static_cast<signed_index_type>(_size) - (produced - consumed);
     }
 
-    void publish(signed_index_type sequence) {
-        setAvailable(sequence);
+    // marks the claimed slots '(sequence - n_slots_to_publish, sequence]' as published
+    void publish(signed_index_type sequence, std::size_t n_slots_to_publish = 1) {
+        setAvailable(sequence - static_cast<signed_index_type>(n_slots_to_publish) + 1, n_slots_to_publish);
         if constexpr (hasSignalAllWhenBlocking<WAIT_STRATEGY>) {
             _waitStrategy.signalAllWhenBlocking();
         }
@@ -260,29 +270,235 @@ public:
 
     [[nodiscard]] forceinline bool isAvailable(signed_index_type sequence) const noexcept {
         const auto index = calculateIndex(sequence);
-        const auto flag  = calculateAvailabilityFlag(sequence);
+        const auto bit   = (_availableBits[index / kBitsPerWord].load(std::memory_order_acquire) >> (index % kBitsPerWord)) & 1U;
 
-        return _availableBuffer[static_cast<std::size_t>(index)] == flag;
+        return bit == calculateAvailabilityFlag(sequence);
     }
 
     [[nodiscard]] forceinline signed_index_type getHighestPublishedSequence(const signed_index_type lowerBound, const signed_index_type availableSequence) const noexcept {
-        for (signed_index_type sequence = lowerBound; sequence <= availableSequence; sequence++) {
-            if (!isAvailable(sequence)) {
-                return sequence - 1;
+        for (signed_index_type sequence = lowerBound; sequence <= availableSequence;) {
+            const std::size_t index  = calculateIndex(sequence);
+            const std::size_t offset = index % kBitsPerWord;
+            // N.B. the round parity is constant within a segment since rounds start at word boundaries (or at index '0' for buffers < 64 slots)
+            const auto nSegment      = static_cast<signed_index_type>(std::min({ kBitsPerWord - offset, static_cast<std::size_t>(_size) - index, static_cast<std::size_t>(availableSequence - sequence) + 1 }));
+            std::uint64_t word       = _availableBits[index / kBitsPerWord].load(std::memory_order_acquire);
+            if (calculateAvailabilityFlag(sequence) == 0U) {
+                word = ~word; // -> published slots are '1'
             }
+            if (const auto nPublished = static_cast<signed_index_type>(std::countr_one(word >> offset)); nPublished < nSegment) {
+                return sequence + nPublished - 1;
+            }
+            sequence += nSegment;
         }
 
         return availableSequence;
     }
 
-private:
-    void                      setAvailable(signed_index_type sequence) noexcept { setAvailableBufferValue(calculateIndex(sequence), calculateAvailabilityFlag(sequence)); }
-    forceinline void          setAvailableBufferValue(std::size_t index, std::int32_t flag) noexcept { _availableBuffer[index] = flag; }
-    [[nodiscard]] forceinline std::int32_t calculateAvailabilityFlag(const signed_index_type sequence) const noexcept { return static_cast<std::int32_t>(static_cast<signed_index_type>(sequence) >> _indexShift); }
-    [[nodiscard]] forceinline std::size_t calculateIndex(const signed_index_type sequence) const noexcept { return static_cast<std::size_t>(static_cast<std::int32_t>(sequence) & (_size - 1)); }
+protected:
+    static constexpr std::size_t kBitsPerWord = 64;
+    [[nodiscard]] static constexpr std::size_t wordCount(std::size_t size) noexcept { return (size + kBitsPerWord - 1) / kBitsPerWord; }
+
+    void initialiseAvailableBits() noexcept {
+        // N.B. the first round (parity '0') starts with all slots unpublished
+        for (auto &word : _availableBits) {
+            word.store(~std::uint64_t{ 0 }, std::memory_order_relaxed);
+        }
+    }
+
+    // calls 'fn(wordIndex, mask, sequence)' once per word (and round) covered by the slots '[sequence, sequence + n_slots)'
+    template<typename Fn>
+    forceinline void forEachWord(signed_index_type sequence, std::size_t n_slots, Fn &&fn) const noexcept {
+        while (n_slots > 0) {
+            const std::size_t index    = calculateIndex(sequence);
+            const std::size_t offset   = index % kBitsPerWord;
+            const std::size_t nSegment = std::min({ n_slots, kBitsPerWord - offset, static_cast<std::size_t>(_size) - index });
+            const std::uint64_t mask   = (nSegment == kBitsPerWord ? ~std::uint64_t{ 0 } : ((std::uint64_t{ 1 } << nSegment) - 1U)) << offset;
+            fn(index / kBitsPerWord, mask, sequence);
+            sequence += static_cast<signed_index_type>(nSegment);
+            n_slots -= nSegment;
+        }
+    }
+
+    void setAvailable(signed_index_type sequence, std::size_t n_slots) noexcept {
+        forEachWord(sequence, n_slots, [this](std::size_t word, std::uint64_t mask, signed_index_type segmentStart) { // one atomic operation per word and round
+            if (calculateAvailabilityFlag(segmentStart) != 0U) {
+                _availableBits[word].fetch_or(mask, std::memory_order_release);
+            } else {
+                _availableBits[word].fetch_and(~mask, std::memory_order_release);
+            }
+        });
+    }
+    [[nodiscard]] forceinline std::uint64_t calculateAvailabilityFlag(const signed_index_type sequence) const noexcept { return static_cast<std::uint64_t>(sequence >> _indexShift) & 1U; }
+    [[nodiscard]] forceinline std::size_t calculateIndex(const signed_index_type sequence) const noexcept { return static_cast<std::size_t>(sequence) & static_cast<std::size_t>(_size - 1); }
 };
 
 static_assert(ClaimStrategy<MultiThreadedStrategy<1024, NoWaitStrategy>>);
+
+/**
+ * Multi-producer claim strategy for fine-grained producers (e.g. many small messages): rather than one CAS on the shared
+ * cursor per claim, each producer CAS-reserves a block of 'batchSize()' slots at once and sub-allocates claims from it
+ * locally (see 'Producer', one instance per writer).
+ *
+ * The unused tail of a block (claim does not fit, 'Producer::flush()', or the producer's destruction) is returned to the
+ * cursor if no other producer claimed in the meantime, otherwise it is published as a 'gap': padding slots marked in a
+ * second per-slot bitmap that readers skip so that they never see holes (see 'isGap(..)', 'firstGap(..)' and 'gapEnd(..)').
+ *
+ * N.B. slots claimed by a producer but not yet published stall readers of subsequent slots: producers that go idle
+ * should call 'flush()' to release their partially used block.
+ */
+template<std::size_t SIZE = std::dynamic_extent, WaitStrategy WAIT_STRATEGY = BusySpinWaitStrategy>
+class alignas(hardware_constructive_interference_size) BatchedMultiThreadedStrategy : public MultiThreadedStrategy<SIZE, WAIT_STRATEGY> {
+    using Base = MultiThreadedStrategy<SIZE, WAIT_STRATEGY>;
+    using Base::_size;
+    using Base::kBitsPerWord;
+    using typename Base::signed_index_type;
+    std::vector<std::atomic<std::uint64_t>> _gapBits; // one bit per ringbuffer slot, '1': padding slot of the current round
+    const std::size_t _batchSize;
+
+    [[nodiscard]] static constexpr std::size_t defaultBatchSize(std::size_t size) noexcept { return std::clamp<std::size_t>(size / 64, 1, 256); }
+
+public:
+    explicit
+    BatchedMultiThreadedStrategy(Sequence &cursor, WAIT_STRATEGY &waitStrategy) requires (SIZE != std::dynamic_extent)
+    : Base(cursor, waitStrategy), _gapBits(Base::wordCount(SIZE)), _batchSize(defaultBatchSize(SIZE)) {}
+
+    explicit
+    BatchedMultiThreadedStrategy(Sequence &cursor, WAIT_STRATEGY &waitStrategy, std::size_t buffer_size, std::size_t batch_size = 0)
+    requires (SIZE == std::dynamic_extent)
+    : Base(cursor, waitStrategy, buffer_size), _gapBits(Base::wordCount(buffer_size)),
+      _batchSize(batch_size == 0 ? defaultBatchSize(buffer_size) : std::min(batch_size, buffer_size)) {}
+
+    [[nodiscard]] constexpr std::size_t batchSize() const noexcept { return _batchSize; }
+
+    // marks the claimed slots '(sequence - n_slots_to_publish, sequence]' as published, clearing stale gap markers of previous rounds
+    void publish(signed_index_type sequence, std::size_t n_slots_to_publish = 1) {
+        // N.B. relaxed: ordered before the readers' acquire by the release in 'setAvailable(..)'
+        Base::forEachWord(sequence - static_cast<signed_index_type>(n_slots_to_publish) + 1, n_slots_to_publish, [this](std::size_t word, std::uint64_t mask, signed_index_type) {
+            if (_gapBits[word].load(std::memory_order_relaxed) & mask) { // gaps are rare -> avoid the RMW in the common case
+                _gapBits[word].fetch_and(~mask, std::memory_order_relaxed);
+            }
+        });
+        Base::publish(sequence, n_slots_to_publish);
+    }
+
+    // publishes the claimed slots '(sequence - n_slots, sequence]' as padding that readers skip
+    void publishGap(signed_index_type sequence, std::size_t n_slots) {
+        Base::forEachWord(sequence - static_cast<signed_index_type>(n_slots) + 1, n_slots, [this](std::size_t word, std::uint64_t mask, signed_index_type) {
+            _gapBits[word].fetch_or(mask, std::memory_order_relaxed);
+        });
+        Base::publish(sequence, n_slots);
+    }
+
+    // N.B. the gap queries are valid only for published sequences
+    [[nodiscard]] forceinline bool isGap(signed_index_type sequence) const noexcept {
+        const auto index = Base::calculateIndex(sequence);
+        return ((_gapBits[index / kBitsPerWord].load(std::memory_order_relaxed) >> (index % kBitsPerWord)) & 1U) != 0U;
+    }
+
+    // first gap in '[lowerBound, upperBound]', 'upperBound + 1' if there is none
+    [[nodiscard]] signed_index_type firstGap(signed_index_type lowerBound, signed_index_type upperBound) const noexcept { return findFirst<true>(lowerBound, upperBound); }
+
+    // last sequence of the gap starting at 'lowerBound' (limited to 'upperBound')
+    [[nodiscard]] signed_index_type gapEnd(signed_index_type lowerBound, signed_index_type upperBound) const noexcept { return findFirst<false>(lowerBound, upperBound) - 1; }
+
+    /**
+     * producer-local view of the claim strategy, one per writer: claims are sub-allocated from a locally reserved block
+     * and thus require a CAS on the shared cursor only once per 'batchSize()' slots
+     */
+    class Producer {
+        BatchedMultiThreadedStrategy *_shared;
+        signed_index_type             _claimed  = kInitialCursorValue; // last sequence handed out from the local block
+        signed_index_type             _blockEnd = kInitialCursorValue; // last sequence of the local block
+
+        [[nodiscard]] forceinline std::size_t localRemaining() const noexcept { return static_cast<std::size_t>(_blockEnd - _claimed); }
+
+    public:
+        explicit Producer(BatchedMultiThreadedStrategy &shared) noexcept : _shared(std::addressof(shared)) {}
+        Producer(const Producer &)       = delete;
+        void operator=(const Producer &) = delete;
+        ~Producer() { flush(); }
+
+        [[nodiscard]] bool hasAvailableCapacity(const SequenceTable &dependents, const std::size_t requiredCapacity, const signed_index_type cursorValue) const noexcept {
+            return requiredCapacity <= localRemaining() || _shared->hasAvailableCapacity(dependents, requiredCapacity, cursorValue);
+        }
+
+        [[nodiscard]] signed_index_type next(const SequenceTable &dependents, std::size_t n_slots_to_claim = 1) {
+            assert((n_slots_to_claim > 0) && "n_slots_to_claim must be > 0");
+            if (n_slots_to_claim <= localRemaining()) {
+                _claimed += static_cast<signed_index_type>(n_slots_to_claim);
+                return _claimed;
+            }
+            flush(); // N.B. prior to (possibly) blocking: readers must be able to pass our unused tail to free space
+            const std::size_t nBlock = std::max(n_slots_to_claim, _shared->batchSize());
+            _blockEnd                = _shared->Base::next(dependents, nBlock);
+            _claimed                 = _blockEnd - static_cast<signed_index_type>(nBlock - n_slots_to_claim);
+            return _claimed;
+        }
+
+        [[nodiscard]] std::optional<signed_index_type> tryNext(const SequenceTable &dependents, std::size_t n_slots_to_claim = 1) noexcept {
+            assert((n_slots_to_claim > 0) && "n_slots_to_claim must be > 0");
+            if (n_slots_to_claim <= localRemaining()) {
+                _claimed += static_cast<signed_index_type>(n_slots_to_claim);
+                return _claimed;
+            }
+            flush();
+            // N.B. falls back to an exact claim if there is not enough space for a full block
+            for (const std::size_t nBlock : { std::max(n_slots_to_claim, _shared->batchSize()), n_slots_to_claim }) {
+                if (const auto blockEnd = _shared->Base::tryNext(dependents, nBlock); blockEnd) {
+                    _blockEnd = *blockEnd;
+                    _claimed  = _blockEnd - static_cast<signed_index_type>(nBlock - n_slots_to_claim);
+                    return _claimed;
+                }
+            }
+            return std::nullopt;
+        }
+
+        [[nodiscard]] signed_index_type getRemainingCapacity(const SequenceTable &dependents) const noexcept {
+            return _shared->getRemainingCapacity(dependents) + static_cast<signed_index_type>(localRemaining());
+        }
+
+        void publish(signed_index_type sequence, std::size_t n_slots_to_publish = 1) { _shared->publish(sequence, n_slots_to_publish); }
+
+        [[nodiscard]] bool isAvailable(signed_index_type sequence) const noexcept { return _shared->isAvailable(sequence); }
+
+        [[nodiscard]] signed_index_type getHighestPublishedSequence(signed_index_type lowerBound, signed_index_type availableSequence) const noexcept {
+            return _shared->getHighestPublishedSequence(lowerBound, availableSequence);
+        }
+
+        // releases the unused tail of the local block: back to the cursor if no other producer claimed since, as a gap otherwise
+        void flush() noexcept {
+            if (localRemaining() == 0) {
+                return;
+            }
+            if (!_shared->_cursor.compareAndSet(_blockEnd, _claimed)) {
+                _shared->publishGap(_blockEnd, localRemaining());
+            }
+            _blockEnd = _claimed;
+        }
+    };
+
+private:
+    template<bool gap>
+    [[nodiscard]] signed_index_type findFirst(const signed_index_type lowerBound, const signed_index_type upperBound) const noexcept {
+        for (signed_index_type sequence = lowerBound; sequence <= upperBound;) {
+            const std::size_t index  = Base::calculateIndex(sequence);
+            const std::size_t offset = index % kBitsPerWord;
+            const auto nSegment      = static_cast<signed_index_type>(std::min({ kBitsPerWord - offset, static_cast<std::size_t>(_size) - index, static_cast<std::size_t>(upperBound - sequence) + 1 }));
+            std::uint64_t word       = _gapBits[index / kBitsPerWord].load(std::memory_order_relaxed);
+            if constexpr (!gap) {
+                word = ~word;
+            }
+            if (const auto nSkipped = static_cast<signed_index_type>(std::countr_zero(word >> offset)); nSkipped < nSegment) {
+                return sequence + nSkipped;
+            }
+            sequence += nSegment;
+        }
+        return upperBound + 1;
+    }
+};
+
+static_assert(ClaimStrategy<BatchedMultiThreadedStrategy<1024, NoWaitStrategy>>);
+static_assert(ClaimStrategy<BatchedMultiThreadedStrategy<1024, NoWaitStrategy>::Producer>);
 // clang-format on
 
 enum class ProducerType {
@@ -294,7 +510,13 @@ enum class ProducerType {
     /**
      * creates a buffer assuming multiple producer-threads and multiple consumer
      */
-    Multi
+    Multi,
+
+    /**
+     * as 'Multi' but with each producer claiming blocks of slots at once, for many fine-grained producer-threads
+     * N.B. idle producers need to 'flush()' their writer for readers to pass their partially used block
+     */
+    MultiBatched
 };
 
 namespace detail {
@@ -311,9 +533,28 @@ struct producer_type<size, ProducerType::Multi, WAIT_STRATEGY> {
     using value_type = MultiThreadedStrategy<size, WAIT_STRATEGY>;
 };
 
+template<std::size_t size, WaitStrategy WAIT_STRATEGY>
+struct producer_type<size, ProducerType::MultiBatched, WAIT_STRATEGY> {
+    using value_type = BatchedMultiThreadedStrategy<size, WAIT_STRATEGY>;
+};
+
 template<std::size_t size, ProducerType producerType, WaitStrategy WAIT_STRATEGY>
 using producer_type_v = typename producer_type<size, producerType, WAIT_STRATEGY>::value_type;
 
+// the writer's handle on the claim strategy: the shared strategy itself or, if it has one, a producer-local view of it
+template<typename ClaimType>
+struct producer_claim {
+    using type = ClaimType *;
+    static type create(ClaimType &strategy) noexcept { return std::addressof(strategy); }
+};
+
+template<typename ClaimType>
+requires requires { typename ClaimType::Producer; }
+struct producer_claim<ClaimType> {
+    using type = std::unique_ptr<typename ClaimType::Producer>;
+    static type create(ClaimType &strategy) { return std::make_unique<typename ClaimType::Producer>(strategy); }
+};
+
 } // namespace detail
 
 } // namespace gr
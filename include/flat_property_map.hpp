@@ -0,0 +1,354 @@
+#ifndef GRAPH_PROTOTYPE_FLAT_PROPERTY_MAP_HPP
+#define GRAPH_PROTOTYPE_FLAT_PROPERTY_MAP_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <tag.hpp>
+
+namespace fair::graph {
+
+using property_key_id                                = std::uint32_t;
+inline constexpr property_key_id kInvalidPropertyKey = std::numeric_limits<property_key_id>::max();
+
+namespace detail {
+template<typename Tag, std::size_t... Is>
+constexpr property_key_id
+default_tag_index(std::index_sequence<Is...>) noexcept {
+    using tags_type    = std::remove_cvref_t<decltype(tag::DEFAULT_TAGS)>;
+    property_key_id id = kInvalidPropertyKey;
+    std::ignore        = ((std::is_same_v<std::remove_cvref_t<std::tuple_element_t<Is, tags_type>>, Tag> ? (id = static_cast<property_key_id>(Is), true) : false) || ...);
+    return id;
+}
+} // namespace detail
+
+/**
+ * @brief compile-time key ID of a well-known tag, i.e. its index in 'tag::DEFAULT_TAGS' (or 'kInvalidPropertyKey' for other types)
+ */
+template<typename Tag>
+inline constexpr property_key_id default_tag_id = detail::default_tag_index<std::remove_cvref_t<Tag>>(std::make_index_sequence<std::tuple_size_v<std::remove_cvref_t<decltype(tag::DEFAULT_TAGS)>>>());
+
+template<typename Tag>
+concept DefaultTag = default_tag_id<Tag> != kInvalidPropertyKey;
+
+/**
+ * @brief process-wide, thread-safe interning of property keys to dense integer IDs.
+ *
+ * The keys of 'tag::DEFAULT_TAGS' are registered first so that their IDs are known at compile-time ('default_tag_id<Tag>').
+ * IDs are never recycled and the key strings remain valid for the lifetime of the process.
+ */
+class property_key_registry {
+    mutable std::shared_mutex                             _mutex;
+    std::deque<std::string>                               _keys; // deque: stable references for the string_view keys below
+    std::unordered_map<std::string_view, property_key_id> _ids;
+
+    property_key_registry() {
+        std::apply([this](const auto &...tags) { (static_cast<void>(intern(tags.key())), ...); }, tag::DEFAULT_TAGS);
+    }
+
+public:
+    [[nodiscard]] static property_key_registry &
+    instance() noexcept {
+        static auto *instance = new property_key_registry(); // intentionally never destroyed (used by static objects)
+        return *instance;
+    }
+
+    [[nodiscard]] property_key_id
+    intern(std::string_view key) {
+        {
+            std::shared_lock lock(_mutex);
+            if (const auto it = _ids.find(key); it != _ids.end()) {
+                return it->second;
+            }
+        }
+        std::unique_lock lock(_mutex);
+        if (const auto it = _ids.find(key); it != _ids.end()) {
+            return it->second;
+        }
+        const auto id = static_cast<property_key_id>(_keys.size());
+        _ids.emplace(_keys.emplace_back(key), id);
+        return id;
+    }
+
+    [[nodiscard]] property_key_id
+    find(std::string_view key) const noexcept {
+        std::shared_lock lock(_mutex);
+        const auto       it = _ids.find(key);
+        return it == _ids.end() ? kInvalidPropertyKey : it->second;
+    }
+
+    [[nodiscard]] std::string_view
+    key(property_key_id id) const {
+        std::shared_lock lock(_mutex);
+        if (id >= _keys.size()) {
+            throw std::out_of_range(fmt::format("unknown property key id {}", id));
+        }
+        return _keys[id];
+    }
+};
+
+/**
+ * @brief flat property map: key-value pairs kept in a vector sorted by interned key ID ('property_key_registry')
+ *
+ * Lookups are binary searches on integers rather than string comparisons in a tree, merges are linear and the first
+ * 'kInlineCapacity' entries are stored in-place, so that typical tags (sample rate, trigger name/time, ...) do not
+ * allocate. Converts to/from the node-based 'property_map'.
+ *
+ * Example usage:
+ * flat_property_map map{ { tag::SAMPLE_RATE(48'000.f), { "my_key", 42 } } };
+ * map.insert_or_assign(tag::TRIGGER_TIME, pmtv::pmt(uint64_t{ 1 }));  // compile-time key ID
+ * map.insert_or_assign("other_key", pmtv::pmt(1.0));                 // interned at run-time
+ * property_map legacy = map.to_property_map();
+ */
+class flat_property_map {
+public:
+    using value_type                             = std::pair<property_key_id, pmtv::pmt>;
+    static constexpr std::size_t kInlineCapacity = 4;
+
+private:
+    std::array<value_type, kInlineCapacity> _inline{};
+    std::vector<value_type>                 _heap{}; // used exclusively once the map outgrows the in-place storage
+    std::size_t                             _size = 0;
+
+    [[nodiscard]] constexpr bool
+    is_inline() const noexcept {
+        return _heap.empty();
+    }
+
+    [[nodiscard]] static property_key_id
+    id_of(std::string_view key) {
+        return property_key_registry::instance().intern(key);
+    }
+
+    [[nodiscard]] std::span<value_type>
+    entries() noexcept {
+        return is_inline() ? std::span<value_type>(_inline.data(), _size) : std::span<value_type>(_heap);
+    }
+
+    [[nodiscard]] std::span<const value_type>
+    entries() const noexcept {
+        return is_inline() ? std::span<const value_type>(_inline.data(), _size) : std::span<const value_type>(_heap);
+    }
+
+    [[nodiscard]] std::size_t
+    lower_bound(property_key_id id) const noexcept {
+        const auto e = entries();
+        return static_cast<std::size_t>(std::ranges::lower_bound(e, id, std::less<>{}, &value_type::first) - e.begin());
+    }
+
+    void
+    insert_at(std::size_t pos, property_key_id id, pmtv::pmt &&value) {
+        if (is_inline() && _size < kInlineCapacity) {
+            std::move_backward(_inline.begin() + static_cast<std::ptrdiff_t>(pos), _inline.begin() + static_cast<std::ptrdiff_t>(_size), _inline.begin() + static_cast<std::ptrdiff_t>(_size + 1));
+            _inline[pos] = value_type{ id, std::move(value) };
+        } else {
+            if (is_inline()) { // spill to the heap
+                _heap.reserve(2 * kInlineCapacity);
+                std::ranges::move(_inline, std::back_inserter(_heap));
+                std::ranges::fill(_inline, value_type{});
+            }
+            _heap.emplace(_heap.begin() + static_cast<std::ptrdiff_t>(pos), id, std::move(value));
+        }
+        ++_size;
+    }
+
+public:
+    flat_property_map() = default;
+
+    flat_property_map(std::initializer_list<std::pair<std::string, pmtv::pmt>> init) {
+        for (const auto &[key, value] : init) {
+            insert_or_assign(key, value);
+        }
+    }
+
+    explicit flat_property_map(const property_map &map) {
+        for (const auto &[key, value] : map) {
+            insert_or_assign(key, value);
+        }
+    }
+
+    [[nodiscard]] property_map
+    to_property_map() const {
+        property_map map;
+        for (const auto &[id, value] : entries()) {
+            map.emplace(std::string(key(id)), value);
+        }
+        return map;
+    }
+
+    [[nodiscard]] static std::string_view
+    key(property_key_id id) {
+        return property_key_registry::instance().key(id);
+    }
+
+    [[nodiscard]] constexpr std::size_t
+    size() const noexcept {
+        return _size;
+    }
+
+    [[nodiscard]] constexpr bool
+    empty() const noexcept {
+        return _size == 0;
+    }
+
+    void
+    clear() noexcept {
+        std::ranges::fill(_inline.begin(), _inline.begin() + static_cast<std::ptrdiff_t>(std::min(_size, kInlineCapacity)), value_type{});
+        _heap.clear();
+        _size = 0;
+    }
+
+    [[nodiscard]] auto
+    begin() const noexcept {
+        return entries().begin();
+    }
+
+    [[nodiscard]] auto
+    end() const noexcept {
+        return entries().end();
+    }
+
+    [[nodiscard]] const pmtv::pmt *
+    find(property_key_id id) const noexcept {
+        const auto e   = entries();
+        const auto pos = lower_bound(id);
+        return pos < e.size() && e[pos].first == id ? &e[pos].second : nullptr;
+    }
+
+    [[nodiscard]] const pmtv::pmt *
+    find(std::string_view key) const noexcept {
+        const auto id = property_key_registry::instance().find(key);
+        return id == kInvalidPropertyKey ? nullptr : find(id);
+    }
+
+    template<DefaultTag Tag>
+    [[nodiscard]] const pmtv::pmt *
+    find(const Tag &) const noexcept {
+        return find(default_tag_id<Tag>);
+    }
+
+    template<typename Key>
+    [[nodiscard]] bool
+    contains(const Key &key) const noexcept {
+        return find(key) != nullptr;
+    }
+
+    template<typename Key>
+    [[nodiscard]] const pmtv::pmt &
+    at(const Key &key) const {
+        if (const auto *value = find(key)) {
+            return *value;
+        }
+        throw std::out_of_range("flat_property_map::at(..) - key not found");
+    }
+
+    void
+    insert_or_assign(property_key_id id, pmtv::pmt value) {
+        const auto pos = lower_bound(id);
+        if (const auto e = entries(); pos < e.size() && e[pos].first == id) {
+            e[pos].second = std::move(value);
+            return;
+        }
+        insert_at(pos, id, std::move(value));
+    }
+
+    void
+    insert_or_assign(std::string_view key, pmtv::pmt value) {
+        insert_or_assign(id_of(key), std::move(value));
+    }
+
+    template<DefaultTag Tag>
+    void
+    insert_or_assign(const Tag &, pmtv::pmt value) {
+        insert_or_assign(default_tag_id<Tag>, std::move(value));
+    }
+
+    void
+    insert_or_assign(const std::pair<std::string, pmtv::pmt> &value) {
+        insert_or_assign(value.first, value.second);
+    }
+
+    /**
+     * @brief inserts all entries of 'other' whose keys are not yet present (same semantic as 'std::map::insert(first, last)')
+     */
+    void
+    insert(const flat_property_map &other) {
+        if (other.empty()) {
+            return;
+        }
+        if (empty()) {
+            *this = other;
+            return;
+        }
+        const auto theirs = other.entries();
+        if (is_inline() && _size + theirs.size() <= kInlineCapacity) {
+            for (const auto &[id, value] : theirs) {
+                if (const auto pos = lower_bound(id); pos >= _size || _inline[pos].first != id) {
+                    insert_at(pos, id, pmtv::pmt(value));
+                }
+            }
+            return;
+        }
+        // linear merge of two sorted ranges, entries of 'this' take precedence
+        std::vector<value_type> merged;
+        merged.reserve(_size + theirs.size());
+        auto mine     = entries();
+        auto it       = mine.begin();
+        auto other_it = theirs.begin();
+        while (it != mine.end() || other_it != theirs.end()) {
+            if (other_it == theirs.end() || (it != mine.end() && it->first <= other_it->first)) {
+                if (other_it != theirs.end() && it->first == other_it->first) {
+                    ++other_it;
+                }
+                merged.emplace_back(std::move(*it++));
+            } else {
+                merged.emplace_back(*other_it++);
+            }
+        }
+        std::ranges::fill(_inline, value_type{});
+        _size = merged.size();
+        if (_size <= kInlineCapacity) {
+            std::ranges::move(merged, _inline.begin());
+            _heap.clear();
+        } else {
+            _heap = std::move(merged);
+        }
+    }
+
+    bool
+    erase(property_key_id id) {
+        const auto pos = lower_bound(id);
+        if (pos >= _size || entries()[pos].first != id) {
+            return false;
+        }
+        if (is_inline()) {
+            std::move(_inline.begin() + static_cast<std::ptrdiff_t>(pos + 1), _inline.begin() + static_cast<std::ptrdiff_t>(_size), _inline.begin() + static_cast<std::ptrdiff_t>(pos));
+            _inline[_size - 1] = value_type{};
+        } else {
+            _heap.erase(_heap.begin() + static_cast<std::ptrdiff_t>(pos));
+        }
+        --_size;
+        return true;
+    }
+};
+
+} // namespace fair::graph
+
+#endif // GRAPH_PROTOTYPE_FLAT_PROPERTY_MAP_HPP
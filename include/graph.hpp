@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <complex>
+#include <cstring>
 #include <iostream>
 #include <map>
 #include <ranges>
@@ -68,12 +69,16 @@ class dynamic_port {
         resize_buffer(std::size_t min_size) noexcept
                 = 0;
 
+        [[nodiscard]] virtual gr::memory_lock_result
+        lock_buffer_memory() noexcept
+                = 0;
+
         [[nodiscard]] virtual connection_result_t
         disconnect() noexcept
                 = 0;
 
         [[nodiscard]] virtual connection_result_t
-        connect(dynamic_port &dst_port)
+        connect(dynamic_port &dst_port, connection_mode_t mode)
                 = 0;
 
         // internal runtime polymorphism access
@@ -164,16 +169,29 @@ class dynamic_port {
             return _value.resize_buffer(min_size);
         }
 
+        [[nodiscard]] gr::memory_lock_result
+        lock_buffer_memory() noexcept override {
+            return _value.lock_buffer_memory();
+        }
+
         [[nodiscard]] connection_result_t
         disconnect() noexcept override {
             return _value.disconnect();
         }
 
         [[nodiscard]] connection_result_t
-        connect(dynamic_port &dst_port) override {
+        connect(dynamic_port &dst_port, connection_mode_t mode) override {
             if constexpr (T::IS_OUTPUT) {
-                auto src_buffer = _value.writer_handler_internal();
-                return dst_port.update_reader_internal(src_buffer) ? connection_result_t::SUCCESS : connection_result_t::FAILED;
+                const bool was_connected = _value.is_connected();
+                auto       src_buffer    = _value.writer_handler_internal();
+                src_buffer.mode          = mode;
+                if (dst_port.update_reader_internal(src_buffer)) {
+                    return connection_result_t::SUCCESS;
+                }
+                if (!was_connected) {
+                    std::ignore = _value.disconnect(); // N.B. rejected by the input: w/o readers, the output falls back to its null handlers
+                }
+                return connection_result_t::FAILED;
             } else {
                 assert(!"This works only on input ports");
                 return connection_result_t::FAILED;
@@ -236,14 +254,19 @@ public:
         return connection_result_t::FAILED;
     }
 
+    [[nodiscard]] gr::memory_lock_result
+    lock_buffer_memory() noexcept {
+        return _accessor->lock_buffer_memory();
+    }
+
     [[nodiscard]] connection_result_t
     disconnect() noexcept {
         return _accessor->disconnect();
     }
 
     [[nodiscard]] connection_result_t
-    connect(dynamic_port &dst_port) {
-        return _accessor->connect(dst_port);
+    connect(dynamic_port &dst_port, connection_mode_t mode = connection_mode_t::BLOCKING) {
+        return _accessor->connect(dst_port, mode);
     }
 };
 
@@ -425,6 +448,15 @@ public:
     [[nodiscard]] virtual work_return_t
     work() = 0;
 
+    /**
+     * @brief the node's fixed input-to-output sample ratio as {N, M}, i.e. N input samples yield M output samples
+     * (see 'ResamplingRatio<N, M>'), {1, 1} for nodes without a declared ratio
+     */
+    [[nodiscard]] virtual std::pair<std::size_t, std::size_t>
+    resampling_ratio() const noexcept {
+        return { 1_UZ, 1_UZ };
+    }
+
     [[nodiscard]] virtual void *
     raw() = 0;
 };
@@ -527,6 +559,16 @@ public:
         return node_ref().settings();
     }
 
+    [[nodiscard]] std::pair<std::size_t, std::size_t>
+    resampling_ratio() const noexcept override {
+        using Node = std::remove_cvref_t<decltype(node_ref())>;
+        if constexpr (requires { typename Node::Resampling; }) {
+            return { Node::Resampling::input_chunk_size, Node::Resampling::output_chunk_size };
+        } else {
+            return { 1_UZ, 1_UZ };
+        }
+    }
+
     [[nodiscard]] void *
     raw() override {
         return std::addressof(node_ref());
@@ -545,6 +587,7 @@ public: // TODO: consider making this private and to use accessors (that can be
     int32_t     _weight;
     std::string _name; // custom edge name
     bool        _connected;
+    connection_mode_t _mode = connection_mode_t::BLOCKING;
 
 public:
     edge()             = delete;
@@ -561,8 +604,9 @@ public:
     operator=(edge &&) noexcept
             = default;
 
-    edge(node_model *src_node, std::size_t src_port_index, node_model *dst_node, std::size_t dst_port_index, std::size_t min_buffer_size, int32_t weight, std::string_view name)
-        : _src_node(src_node), _dst_node(dst_node), _src_port_index(src_port_index), _dst_port_index(dst_port_index), _min_buffer_size(min_buffer_size), _weight(weight), _name(name) {}
+    edge(node_model *src_node, std::size_t src_port_index, node_model *dst_node, std::size_t dst_port_index, std::size_t min_buffer_size, int32_t weight, std::string_view name,
+         connection_mode_t mode = connection_mode_t::BLOCKING)
+        : _src_node(src_node), _dst_node(dst_node), _src_port_index(src_port_index), _dst_port_index(dst_port_index), _min_buffer_size(min_buffer_size), _weight(weight), _name(name), _mode(mode) {}
 
     [[nodiscard]] constexpr const node_model &
     src_node() const noexcept {
@@ -603,6 +647,11 @@ public:
     is_connected() const noexcept {
         return _connected;
     }
+
+    [[nodiscard]] constexpr connection_mode_t
+    mode() const noexcept {
+        return _mode;
+    }
 };
 
 class graph {
@@ -641,7 +690,7 @@ private:
     template<std::size_t src_port_index, std::size_t dst_port_index, typename Source, typename SourcePort, typename Destination, typename DestinationPort>
     [[nodiscard]] connection_result_t
     connect_impl(Source &src_node_raw, SourcePort &source_port, Destination &dst_node_raw, DestinationPort &destination_port, std::size_t min_buffer_size = 65536, int32_t weight = 0,
-                 std::string_view name = "unnamed edge") {
+                 std::string_view name = "unnamed edge", connection_mode_t mode = connection_mode_t::BLOCKING) {
         static_assert(std::is_same_v<typename SourcePort::value_type, typename DestinationPort::value_type>, "The source port type needs to match the sink port type");
 
         if (!std::any_of(_nodes.begin(), _nodes.end(), [&](const auto &registered_node) { return registered_node->raw() == std::addressof(src_node_raw); })
@@ -649,7 +698,7 @@ private:
             throw std::runtime_error(fmt::format("Can not connect nodes that are not registered first:\n {}:{} -> {}:{}\n", src_node_raw.name(), src_port_index, dst_node_raw.name(), dst_port_index));
         }
 
-        auto result = source_port.connect(destination_port);
+        auto result = source_port.connect(destination_port, mode);
         if (result == connection_result_t::SUCCESS) {
             auto find_wrapper = [this](auto *node) {
                 auto it = std::find_if(_nodes.begin(), _nodes.end(), [node](auto &wrapper) { return wrapper->raw() == node; });
@@ -660,7 +709,7 @@ private:
             };
             auto *src_node = find_wrapper(&src_node_raw);
             auto *dst_node = find_wrapper(&dst_node_raw);
-            _edges.emplace_back(src_node, src_port_index, dst_node, src_port_index, min_buffer_size, weight, name);
+            _edges.emplace_back(src_node, src_port_index, dst_node, src_port_index, min_buffer_size, weight, name, mode);
         }
 
         return result;
@@ -671,9 +720,10 @@ private:
     // connect(source) and .to(destination)
     template<typename Source, typename Port, std::size_t src_port_index = 1_UZ>
     struct source_connector {
-        graph  &self;
-        Source &source;
-        Port   &port;
+        graph            &self;
+        Source           &source;
+        Port             &port;
+        connection_mode_t mode = connection_mode_t::BLOCKING;
 
         source_connector(graph &_self, Source &_source, Port &_port) : self(_self), source(_source), port(_port) {}
 
@@ -689,13 +739,23 @@ private:
             if (!is_node_known(source) || !is_node_known(destination)) {
                 throw fmt::format("Source {} and/or destination {} do not belong to this graph\n", source.name(), destination.name());
             }
-            self._connection_definitions.push_back([self = &self, source = &source, source_port = &port, destination = &destination, destination_port = &destination_port]() {
-                return self->connect_impl<src_port_index, dst_port_index>(*source, *source_port, *destination, *destination_port);
+            self._connection_definitions.push_back([self = &self, source = &source, source_port = &port, destination = &destination, destination_port = &destination_port, mode = mode]() {
+                return self->connect_impl<src_port_index, dst_port_index>(*source, *source_port, *destination, *destination_port, 65536, 0, "unnamed edge", mode);
             });
             return connection_result_t::SUCCESS;
         }
 
     public:
+        /**
+         * marks the connection as lossy, i.e. the destination never back-pressures the source, e.g.:
+         * flow.connect<"out">(source).non_blocking().to<"in">(gui_sink);
+         */
+        [[nodiscard]] source_connector &&
+        non_blocking() && noexcept {
+            mode = connection_mode_t::NON_BLOCKING;
+            return std::move(*this);
+        }
+
         template<typename Destination, typename DestinationPort, std::size_t dst_port_index = meta::invalid_index>
         [[nodiscard]] constexpr auto
         to(Destination &destination, DestinationPort Destination::*member_ptr) {
@@ -818,8 +878,54 @@ public:
 
     template<typename Source, typename Sink>
     connection_result_t
-    dynamic_connect(Source &source, std::size_t source_index, Sink &sink, std::size_t sink_index) {
-        return dynamic_output_port(source, source_index).connect(dynamic_input_port(sink, sink_index));
+    dynamic_connect(Source &source, std::size_t source_index, Sink &sink, std::size_t sink_index, connection_mode_t mode = connection_mode_t::BLOCKING) {
+        return dynamic_output_port(source, source_index).connect(dynamic_input_port(sink, sink_index), mode);
+    }
+
+    /**
+     * @brief resizes the buffer of the given output port without losing the samples and tags that are still to be consumed,
+     * the connected input ports follow the new buffer on their next access.
+     *
+     * N.B. to be called while the scheduler is paused, i.e. in-between and not during the nodes' 'work()' invocations
+     */
+    template<typename Source>
+    connection_result_t
+    resize_buffer(Source &source, std::size_t source_index, std::size_t min_size) {
+        auto &source_node = find_node(source);
+        if (source_index >= source_node->dynamic_output_ports_size()) {
+            return connection_result_t::FAILED;
+        }
+        const connection_result_t result = source_node->dynamic_output_port(source_index).resize_buffer(min_size);
+        if (result == connection_result_t::SUCCESS) {
+            for (auto &e : _edges) {
+                if (e._src_node == source_node.get() && e._src_port_index == source_index) {
+                    e._min_buffer_size = min_size;
+                }
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief prefaults and pins (mlock) the stream and tag buffers of all output ports, i.e. the memory of all edges, e.g.
+     * once after the scheduler's initialisation to avoid the page faults of the first pass. Failures (usually exceeding
+     * 'RLIMIT_MEMLOCK', see 'ulimit -l') are non-fatal -- the memory is still prefaulted -- and reported on stderr.
+     * @return the total of locked bytes as well as the failures
+     */
+    gr::memory_lock_result
+    lock_all_edge_memory() {
+        gr::memory_lock_result result;
+        for (auto &node : _nodes) {
+            for (std::size_t i = 0; i < node->dynamic_output_ports_size(); i++) {
+                result += node->dynamic_output_port(i).lock_buffer_memory();
+            }
+        }
+        if (!result.ok()) {
+            fmt::print(stderr, "graph::lock_all_edge_memory() - locked {} bytes, failed to lock {} bytes of {} buffers ({}), RLIMIT_MEMLOCK: {}\n", result.locked_bytes, result.failed_bytes,
+                       result.n_failures, std::strerror(result.error),
+                       result.memlock_limit == std::numeric_limits<std::size_t>::max() ? std::string("unlimited") : fmt::format("{} bytes", result.memlock_limit));
+        }
+        return result;
     }
 
     const std::vector<std::function<connection_result_t()>> &
@@ -3,8 +3,11 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cstddef>
+#include <iterator>
 #include <memory>
+#include <ranges>
 #include <span>
 #include <stdexcept>
 #include <type_traits>
@@ -54,16 +57,31 @@ class history_buffer {
 
     /**
      * @brief maps the logical index to the physical index in the buffer.
+     *
+     * Valid logical indices are within ]-capacity, 0], hence the physical position is within [0, 2 * capacity[ and
+     * a single conditional subtraction (or a mask for power-of-two fixed capacities) replaces the integer division.
      */
     constexpr inline std::size_t
     map_index(signed_index_type index) const noexcept {
-        if constexpr (N == std::dynamic_extent) {
-            return static_cast<std::size_t>((static_cast<signed_index_type>(_write_position + _capacity - 1) + index)) % _capacity;
+        const auto position = static_cast<std::size_t>(static_cast<signed_index_type>(_write_position + _capacity - 1) + index);
+        if constexpr (N != std::dynamic_extent && std::has_single_bit(N)) {
+            return position & (N - 1);
         } else {
-            return static_cast<std::size_t>((static_cast<signed_index_type>(_write_position + N - 1) + index)) % N;
+            return position < _capacity ? position : position - _capacity;
         }
     }
 
+    /**
+     * @brief copies 'length' elements to the physical position 'position' and its mirror at 'position + capacity'.
+     */
+    template<typename Iter>
+    constexpr void
+    copy_segment(Iter first, std::size_t length, std::size_t position) noexcept {
+        const auto begin = _buffer.begin() + static_cast<typename buffer_type::difference_type>(position);
+        std::copy_n(first, length, begin);
+        std::copy_n(begin, length, begin + static_cast<typename buffer_type::difference_type>(_capacity));
+    }
+
 public:
     constexpr explicit history_buffer() noexcept { static_assert(N != std::dynamic_extent, "need to specify capacity"); }
 
@@ -88,12 +106,34 @@ public:
 
     /**
      * @brief Adds a range of elements the end expiring the oldest elements beyond the buffer's capacities.
+     *
+     * For forward iterators, the range is written as at most two contiguous block copies (split at the wrap-around
+     * point) into the buffer and its mirror. Only the newest 'capacity()' elements of longer ranges are copied.
      */
     template<typename Iter>
     constexpr void
     push_back_bulk(Iter cbegin, Iter cend) noexcept {
-        for (auto it = cbegin; it != cend; ++it) {
-            push_back(*it);
+        if constexpr (std::forward_iterator<Iter>) {
+            auto n_elements = static_cast<std::size_t>(std::distance(cbegin, cend));
+            if (n_elements >= _capacity) {
+                std::advance(cbegin, static_cast<std::iter_difference_t<Iter>>(n_elements - _capacity));
+                copy_segment(cbegin, _capacity, 0);
+                _write_position = 0;
+                _size           = _capacity;
+                return;
+            }
+            const auto n_first = std::min(n_elements, _capacity - _write_position);
+            copy_segment(cbegin, n_first, _write_position);
+            copy_segment(std::next(cbegin, static_cast<std::iter_difference_t<Iter>>(n_first)), n_elements - n_first, 0);
+            _write_position += n_elements;
+            if (_write_position >= _capacity) {
+                _write_position -= _capacity;
+            }
+            _size = std::min(_size + n_elements, _capacity);
+        } else {
+            for (auto it = cbegin; it != cend; ++it) {
+                push_back(*it);
+            }
         }
     }
 
@@ -103,8 +143,12 @@ public:
     template<typename Range>
     constexpr void
     push_back_bulk(const Range &range) noexcept {
-        for (const auto &item : range) {
-            push_back(item);
+        if constexpr (std::ranges::common_range<const Range>) {
+            push_back_bulk(std::ranges::begin(range), std::ranges::end(range));
+        } else {
+            for (const auto &item : range) {
+                push_back(item);
+            }
         }
     }
 
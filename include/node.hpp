@@ -2,6 +2,7 @@
 #define GNURADIO_NODE_HPP
 
 #include <map>
+#include <numeric>
 
 #include <annotated.hpp>
 #include <node_traits.hpp>
@@ -42,6 +43,47 @@ simdize_tuple_load_and_apply(auto width, const std::tuple<Ts...> &rngs, auto off
     }(std::make_index_sequence<sizeof...(Ts)>());
 }
 
+/**
+ * @brief mask selecting the first 'n' lanes of the SIMD type 'V'
+ */
+template<meta::any_simd V>
+[[nodiscard]] constexpr typename V::mask_type
+simd_first_n_mask(std::size_t n) noexcept {
+    using T = typename V::value_type;
+    return V([](auto lane) { return static_cast<T>(lane); }) < V(static_cast<T>(n));
+}
+
+/**
+ * @brief masked variant of 'simdize_tuple_load_and_apply' loading only the first 'n' (< width) samples of each range:
+ * the remaining lanes repeat the last loaded sample, i.e. neither read past the ranges nor compute on undefined values
+ */
+template<std::ranges::contiguous_range... Ts>
+constexpr auto
+simdize_tuple_masked_load_and_apply(auto width, const std::tuple<Ts...> &rngs, std::size_t offset, std::size_t n, auto &&fun) {
+    using Tup = meta::simdize<std::tuple<std::ranges::range_value_t<Ts>...>, width>;
+    return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+        const auto load = [offset, n]<typename V>(const auto &range) {
+            const auto *data = std::ranges::data(range) + offset;
+            V           simd(data[n - 1]);
+            stdx::where(simd_first_n_mask<V>(n), simd).copy_from(data, stdx::element_aligned);
+            return simd;
+        };
+        return fun(load.template operator()<std::tuple_element_t<Is, Tup>>(std::get<Is>(rngs))...);
+    }(std::make_index_sequence<sizeof...(Ts)>());
+}
+
+/**
+ * @brief number of samples in front of the first sample of 'range' that is aligned for 'stdx::vector_aligned' accesses
+ * of 'width'-wide SIMD objects
+ */
+[[nodiscard]] inline std::size_t
+samples_to_simd_alignment(auto width, const auto &range) noexcept {
+    using T                         = std::remove_cvref_t<decltype(*std::data(range))>;
+    constexpr std::size_t alignment = stdx::memory_alignment_v<meta::simdize<T, decltype(width)::value>>;
+    const std::size_t     offset    = reinterpret_cast<std::uintptr_t>(std::data(range)) % alignment;
+    return offset == 0 || offset % sizeof(T) != 0 ? 0_UZ : (alignment - offset) / sizeof(T);
+}
+
 enum class work_return_t {
     ERROR                     = -100, /// error occurred in the work function
     INSUFFICIENT_OUTPUT_ITEMS = -3,   /// work requires a larger output buffer to produce output
@@ -172,7 +214,26 @@ concept NodeType = requires(T t, std::string str, std::size_t index) {
  *      std::ranges::copy(input, output | std::views::transform([a = this->_factor](T x) { return static_cast<R>(x * a); }));
  *  }
  * @endcode
- * <li> <b>case 2a</b>: N-in->M-out -> process_bulk(<ins...>, <outs...>) N,M fixed -> aka. interpolator (M>N) or decimator (M<N) (to-be-done)
+ * Input ports declaring a look-back (i.e. `in.set_history_size(N)`) pass the N previously consumed samples in front of the
+ * new ones, i.e. `input.size() == N + output.size()`, so that e.g. FIR filters can read their history in-place.
+ * Input ports declaring overlapping windows (i.e. `in.set_window(N, H)`) are processed in whole hops only: for k hops the
+ * input holds the k windows `input.subspan(j * H, N)` (i.e. `input.size() == output.size() + N - H`) and the stream advances by k * H.
+ * By default, the inputs are split so that each call sees at most one tag on its first sample. Nodes annotated with 'BatchedTags'
+ * instead process all available samples in one call and read the call's tags as sorted '(relative index, map)' pairs via
+ * `this->input_tag_batch()`. The data is only split where a tag changes the node's settings (i.e. carries one of its
+ * 'auto_update_parameters()' keys or switches its 'tag::CONTEXT') so that the new settings apply exactly from the tagged sample onwards.
+ * <li> <b>case 2a</b>: N-in->M-out -> process_bulk(<ins...>, <outs...>) N,M fixed -> aka. interpolator (M>N) or decimator (M<N)
+ * declared via the 'ResamplingRatio<N, M>' annotation, e.g. a decimator by four:
+ * @code
+ * struct decimate_by_four : node<decimate_by_four, IN<float, 0, N_MAX, "in">, OUT<float, 0, N_MAX, "out">, ResamplingRatio<4, 1>> {
+ *  [[nodiscard]] constexpr work_return_t process_bulk(std::span<const float> input, std::span<float> output) const noexcept {
+ *      for (std::size_t i = 0; i < output.size(); ++i) { output[i] = input[4 * i]; } // input.size() == 4 * output.size()
+ *      return work_return_t::OK;
+ *  }
+ * };
+ * @endcode
+ * The inputs are processed in whole multiples of N samples (limited by the free space on the outputs), the outputs advance
+ * by the corresponding multiples of M samples and tags on the first input chunk are forwarded to the first output sample.
  * <li> <b>case 2b</b>: N-in->M-out -> process_bulk(<{ins,tag-IO}...>, <{outs,tag-IO}...>) user-level tag handling (to-be-done)
  * <li> <b>case 3</b> -- generic `work()` providing full access/logic capable of handling any N-in->M-out tag-handling case:
  * @code
@@ -217,21 +278,25 @@ class node : protected std::tuple<Arguments...> {
     static std::atomic_size_t _unique_id_counter;
 
 public:
-    using derived_t                                       = Derived;
-    using node_template_parameters                        = meta::typelist<Arguments...>;
-    using Description                                     = typename node_template_parameters::template find_or_default<is_doc, EmptyDoc>;
-    constexpr static tag_propagation_policy_t tag_policy  = tag_propagation_policy_t::TPP_ALL_TO_ALL;
-    const std::size_t                         unique_id   = _unique_id_counter++;
-    const std::string                         unique_name = fmt::format("{}#{}", fair::meta::type_name<Derived>(), unique_id);
+    using derived_t                                        = Derived;
+    using node_template_parameters                         = meta::typelist<Arguments...>;
+    using Description                                      = typename node_template_parameters::template find_or_default<is_doc, EmptyDoc>;
+    using Resampling                                       = typename node_template_parameters::template find_or_default<is_resampling_ratio, DefaultResamplingRatio>;
+    constexpr static tag_propagation_policy_t tag_policy   = tag_propagation_policy_t::TPP_ALL_TO_ALL;
+    constexpr static bool                     batched_tags = node_template_parameters::template contains<BatchedTags>;
+    const std::size_t                         unique_id    = _unique_id_counter++;
+    const std::string                         unique_name  = fmt::format("{}#{}", fair::meta::type_name<Derived>(), unique_id);
 
 protected:
     using setting_map = std::map<std::string, int, std::less<>>;
-    std::string               _name{ std::string(fair::meta::type_name<Derived>()) }; /// user-defined name
-    property_map              _meta_information;                                      /// used to store non-graph-processing information like UI block position etc.
-    bool                      _input_tags_present  = false;
-    bool                      _output_tags_changed = false;
-    std::vector<property_map> _tags_at_input;
-    std::vector<property_map> _tags_at_output;
+    std::string                     _name{ std::string(fair::meta::type_name<Derived>()) }; /// user-defined name
+    property_map                    _meta_information;                                      /// used to store non-graph-processing information like UI block position etc.
+    bool                            _input_tags_present  = false;
+    bool                            _output_tags_changed = false;
+    std::vector<property_map>       _tags_at_input;
+    std::vector<property_map>       _tags_at_output;
+    std::vector<relative_tag_t>     _tag_batch;                                             /// 'BatchedTags' nodes: tags of the current work() iteration, sorted by index
+    std::span<const relative_tag_t> _tag_batch_view;                                        /// 'BatchedTags' nodes: tags of the current process_bulk(..) call
 
     // intermediate non-real-time<->real-time setting states
     std::unique_ptr<settings_base> _settings = std::make_unique<basic_settings<Derived>>(self());
@@ -253,7 +318,25 @@ protected:
 
     constexpr bool
     space_available_on_output_ports(std::size_t n) {
-        return std::apply([n](const auto &...port) noexcept { return ((n <= port.streamWriter().available()) && ... && true); }, output_ports(&self()));
+        return std::apply([n](const auto &...port) noexcept { return ((n <= writable_samples(port)) && ... && true); }, output_ports(&self()));
+    }
+
+    /**
+     * @brief the number of samples an output accepts per 'work()' call: the space freed by its readers for blocking outputs,
+     * at least one output chunk for drop-newest outputs (only dropped if the buffer is full, as their reservations are all-or-nothing),
+     * and the buffer size for drop-oldest outputs, which overwrite just as many unread samples as needed (see 'gr::OverflowPolicy')
+     */
+    [[nodiscard]] static constexpr std::size_t
+    writable_samples(const auto &output_port) noexcept {
+        const auto &writer = output_port.streamWriter();
+        if constexpr (requires { writer.overflow_policy(); }) {
+            switch (writer.overflow_policy()) {
+            case gr::OverflowPolicy::Block: break;
+            case gr::OverflowPolicy::DropNewest: return std::max(writer.available(), Resampling::output_chunk_size);
+            case gr::OverflowPolicy::DropOldest: return writer.buffer().size();
+            }
+        }
+        return writer.available();
     }
 
 public:
@@ -269,7 +352,11 @@ public:
     }
 
     node(node &&other) noexcept
-        : std::tuple<Arguments...>(std::move(other)), _tags_at_input(std::move(other._tags_at_input)), _tags_at_output(std::move(other._tags_at_output)), _settings(std::move(other._settings)) {}
+        : std::tuple<Arguments...>(std::move(other))
+        , _tags_at_input(std::move(other._tags_at_input))
+        , _tags_at_output(std::move(other._tags_at_output))
+        , _tag_batch(std::move(other._tag_batch))
+        , _settings(std::move(other._settings)) {}
 
     /**
      * @brief user-defined name
@@ -326,6 +413,15 @@ public:
         return { _tags_at_input.data(), _tags_at_input.size() };
     }
 
+    /**
+     * @brief 'BatchedTags' nodes: tags of the current 'process_bulk(..)' call sorted by their index relative to the first
+     * new input sample. Tags within an input port's first hop or 'ResamplingRatio' chunk are mapped onto its first sample.
+     */
+    [[nodiscard]] constexpr std::span<const relative_tag_t>
+    input_tag_batch() const noexcept {
+        return _tag_batch_view;
+    }
+
     [[nodiscard]] constexpr std::span<const property_map>
     output_tags() const noexcept {
         return { _tags_at_output.data(), _tags_at_output.size() };
@@ -372,7 +468,14 @@ public:
         const auto availableForPort            = [&at_least_one_input_has_data]<typename Port>(Port &port) noexcept -> std::pair<std::size_t, std::size_t> {
             std::size_t       availableSamples = port.streamReader().available();
             const std::size_t availableTags    = port.tagReader().available();
-            if (availableTags > 0) {
+            if (availableSamples > 0_UZ) at_least_one_input_has_data = true;
+            // overlapping windows: only complete windows are processed, each advancing the stream by the port's hop size
+            const std::size_t hop = port.hop_size();
+            availableSamples      = availableSamples < port.window_size() ? 0_UZ : (availableSamples - port.window_size()) / hop * hop + hop;
+            // fixed-ratio (N:M) nodes: only whole input chunks are processed
+            const std::size_t granule = std::lcm(hop, Resampling::input_chunk_size);
+            availableSamples -= availableSamples % granule;
+            if (availableTags > 0 && !batched_tags) {
                 // at least one tag is present -> if tag is not on the first tag position read up to the tag position
                 auto tagData                  = port.tagReader().get();
                 auto tag_stream_head_distance = tagData[0].index - port.streamReader().position();
@@ -380,12 +483,12 @@ public:
 
                 if (tag_stream_head_distance > 0 && availableSamples > static_cast<std::size_t>(tag_stream_head_distance)) {
                     // limit number of samples to read up to the next tag <-> forces processing from tag to tag|MAX_SIZE
-                    // N.B. new tags are thus always on the first readable sample
-                    availableSamples = std::min(availableSamples, static_cast<std::size_t>(tag_stream_head_distance));
+                    // N.B. new tags are thus always on the first readable sample (windowed ports and N:M nodes: within the first hop or chunk)
+                    const auto distance = static_cast<std::size_t>(tag_stream_head_distance);
+                    availableSamples    = std::min(availableSamples, std::max(granule, distance / granule * granule));
                     // TODO: handle corner case where the distance to the next tag is less than the ports MIN_SIZE
                 }
             }
-            if (availableSamples > 0_UZ) at_least_one_input_has_data = true;
             if (availableSamples < port.min_buffer_size()) {
                 return { 0_UZ, availableTags };
             } else {
@@ -407,6 +510,34 @@ public:
                        .available_tags_count        = available_values_and_tag_count.second };
     }
 
+    // This function is a template and static to provide easier
+    // transition to C++23's deducing this later
+    template<typename Self>
+    [[nodiscard]] constexpr static std::size_t
+    samples_to_wrap(Self &self) noexcept {
+        // N.B. only buffers in wrap-aware two-span mode (i.e. gr::WrapMode::Split) limit the number of samples
+        const auto port_samples_to_wrap = []<typename Port>(Port &port) noexcept -> std::size_t {
+            if constexpr (Port::IS_INPUT && requires { port.streamReader().samples_to_wrap(); }) {
+                // N.B. the last window extends 'window_size() - hop_size()' samples past the consumed ones (windows on two-span
+                // buffers are rejected by the port, the overlap is accounted for nevertheless)
+                const std::size_t n_samples = port.streamReader().samples_to_wrap();
+                const std::size_t overlap   = port.window_size() - port.hop_size();
+                return n_samples == std::numeric_limits<std::size_t>::max() ? n_samples : n_samples - std::min(n_samples, overlap);
+            } else if constexpr (Port::IS_OUTPUT && requires { port.streamWriter().samples_to_wrap(); }) {
+                return port.streamWriter().samples_to_wrap();
+            } else {
+                return std::numeric_limits<std::size_t>::max();
+            }
+        };
+        const auto min_samples_to_wrap = [&port_samples_to_wrap](auto &...port) noexcept { return std::min({ std::numeric_limits<std::size_t>::max(), port_samples_to_wrap(port)... }); };
+        // N.B. the limit is expressed in input samples, i.e. for N:M nodes the outputs' limit is converted to whole input chunks
+        const std::size_t output_samples_to_wrap = std::apply(min_samples_to_wrap, output_ports(&self));
+        const std::size_t output_limit           = output_samples_to_wrap == std::numeric_limits<std::size_t>::max()
+                                                         ? output_samples_to_wrap
+                                                         : output_samples_to_wrap / Resampling::output_chunk_size * Resampling::input_chunk_size;
+        return std::min(std::apply(min_samples_to_wrap, input_ports(&self)), output_limit);
+    }
+
     // This function is a template and static to provide easier
     // transition to C++23's deducing this later
     auto
@@ -428,6 +559,113 @@ public:
         return success;
     }
 
+    /**
+     * @brief the number of output samples corresponding to 'n_input' input samples, i.e. 'n_input / N * M' for 'ResamplingRatio<N, M>'
+     */
+    [[nodiscard]] static constexpr std::size_t
+    output_samples_for(std::size_t n_input) noexcept {
+        if constexpr (std::is_same_v<Resampling, DefaultResamplingRatio>) {
+            return n_input;
+        } else {
+            return n_input / Resampling::input_chunk_size * Resampling::output_chunk_size;
+        }
+    }
+
+    /**
+     * @brief 'BatchedTags' nodes: consumes the input tags on the next 'n_samples' samples into '_tag_batch', merging those on the same sample
+     */
+    void
+    collect_tag_batch(std::size_t n_samples) noexcept {
+        _tag_batch.clear();
+        // N.B. tags are mapped onto the first sample of their hop or input chunk, i.e. onto boundaries valid for all ports
+        std::size_t granule = Resampling::input_chunk_size;
+        meta::tuple_for_each([&granule](auto &input_port) noexcept { granule = std::lcm(granule, input_port.hop_size()); }, input_ports(&self()));
+        meta::tuple_for_each(
+                [n_samples, granule, this](auto &input_port) noexcept {
+                    const auto  tags     = input_port.tagReader().get();
+                    const auto  position = input_port.streamReader().position();
+                    std::size_t n_tags   = 0;
+                    for (; n_tags < tags.size(); n_tags++) {
+                        // N.B. tags preceding the stream head (e.g. index '-1') are mapped onto the first sample
+                        const std::size_t offset = tags[n_tags].index <= position ? 0_UZ : static_cast<std::size_t>(tags[n_tags].index - position);
+                        if (offset >= n_samples) {
+                            break; // remaining tags belong to the next iteration
+                        }
+                        const std::size_t index = offset / granule * granule;
+                        auto              it    = std::lower_bound(_tag_batch.begin(), _tag_batch.end(), index, [](const relative_tag_t &tag, std::size_t i) { return tag.index < i; });
+                        if (it == _tag_batch.end() || it->index != index) {
+                            it = _tag_batch.insert(it, relative_tag_t{ .index = index, .map = {} });
+                        }
+                        const property_map &map = tag_map(tags[n_tags]);
+                        it->map.insert(map.begin(), map.end());
+                    }
+                    std::ignore = input_port.tagReader().consume(n_tags);
+                },
+                input_ports(&self()));
+        _input_tags_present = !_tag_batch.empty();
+    }
+
+    /**
+     * @brief 'BatchedTags' nodes: calls 'process_bulk(..)' once per range between the tags that change the node's settings
+     * (incl. 'tag::CONTEXT' switches), applies these settings at the range boundaries and forwards all tags to their corresponding output samples
+     */
+    template<typename InputSpans, typename OutputSpans>
+    work_return_t
+    process_bulk_batched(const InputSpans &input_spans, const OutputSpans &output_spans, std::size_t n_samples) noexcept {
+        const auto changes_settings = [this](const property_map &map) {
+            const auto &keys = settings().auto_update_parameters();
+            return map.contains(tag::CONTEXT.key()) || std::any_of(map.begin(), map.end(), [&keys](const auto &entry) { return keys.contains(entry.first); });
+        };
+
+        work_return_t ret       = work_return_t::OK;
+        auto          first_tag = _tag_batch.begin();
+        for (std::size_t begin = 0; begin < n_samples;) {
+            const auto        last_tag = std::find_if(first_tag, _tag_batch.end(), [begin, &changes_settings](const relative_tag_t &tag) { return tag.index > begin && changes_settings(tag.map); });
+            const std::size_t end      = last_tag == _tag_batch.end() ? n_samples : last_tag->index;
+
+            // settings changed by the tag on the first sample apply to the whole [begin, end) range
+            if (first_tag != last_tag && first_tag->index == begin) {
+                settings().auto_update(first_tag->map);
+            }
+            property_map forward_parameters;
+            if (settings().changed()) {
+                forward_parameters = settings().apply_staged_parameters();
+                settings()._changed.store(false);
+            }
+
+            std::for_each(first_tag, last_tag, [begin](relative_tag_t &tag) { tag.index -= begin; });
+            _tag_batch_view             = { first_tag, last_tag };
+            const std::size_t out_begin = output_samples_for(begin);
+            const std::size_t out_end   = output_samples_for(end);
+            // N.B. the input ranges keep the ports' history and window overhang, i.e. the 'input.size() - n_samples' extra samples
+            const work_return_t range_ret = std::apply([this](auto... args) { return static_cast<Derived *>(this)->process_bulk(args...); },
+                                                       std::tuple_cat(meta::tuple_transform([begin, end, n_samples](auto input) { return input.subspan(begin, input.size() - n_samples + end - begin); }, input_spans),
+                                                                      meta::tuple_transform([out_begin, out_end](auto output) { return output.subspan(out_begin, out_end - out_begin); }, output_spans)));
+            if (ret == work_return_t::OK) {
+                ret = range_ret;
+            }
+
+            // TPP_ALL_TO_ALL: N.B. the writers are published after the last range, i.e. tag offsets are relative to the iteration's first output sample
+            const auto publish_on_outputs = [this](const property_map &map, std::size_t output_offset) noexcept {
+                meta::tuple_for_each([&map, output_offset](auto &output_port) noexcept { publish_tag(output_port, map, output_offset); }, output_ports(&self()));
+            };
+            if (!forward_parameters.empty() && (first_tag == last_tag || first_tag->index != 0)) {
+                publish_on_outputs(forward_parameters, out_begin);
+            }
+            std::for_each(first_tag, last_tag, [&](relative_tag_t &tag) {
+                if (tag.index == 0) {
+                    tag.map.insert(forward_parameters.cbegin(), forward_parameters.cend());
+                }
+                publish_on_outputs(tag.map, output_samples_for(begin + tag.index));
+            });
+
+            first_tag = last_tag;
+            begin     = end;
+        }
+        _tag_batch_view = {};
+        return ret;
+    }
+
     template<typename... Ts>
     constexpr auto
     invoke_process_one(Ts &&...inputs) {
@@ -466,6 +704,10 @@ public:
 
         constexpr bool is_source_node     = input_types::size == 0;
         constexpr bool is_sink_node       = output_types::size == 0;
+        constexpr bool is_resampling      = !std::is_same_v<Resampling, DefaultResamplingRatio>;
+        static_assert(!is_resampling || !is_source_node, "N:M resampling ratios require at least one input port");
+        static_assert(!is_resampling || requires { &Derived::process_bulk; }, "N:M resampling ratios require 'process_bulk(..)'");
+        static_assert(!batched_tags || (!is_source_node && requires { &Derived::process_bulk; }), "'BatchedTags' nodes require input ports and 'process_bulk(..)'");
 
         std::size_t    samples_to_process = 0;
         std::size_t    tags_to_process    = 0;
@@ -475,7 +717,7 @@ public:
                           }) {
                 // the (source) node wants to determine the number of samples to process
                 std::size_t max_buffer = std::numeric_limits<std::size_t>::max();
-                meta::tuple_for_each([&max_buffer](auto &&out) { max_buffer = std::min(max_buffer, out.streamWriter().available()); }, output_ports(&self()));
+                meta::tuple_for_each([&max_buffer](auto &&out) { max_buffer = std::min(max_buffer, writable_samples(out)); }, output_ports(&self()));
                 const std::make_signed_t<std::size_t> available_samples = self().available_samples(self());
                 if (available_samples < 0 && max_buffer > 0) {
                     return work_return_t::DONE;
@@ -513,7 +755,7 @@ public:
                 samples_to_process = chunk_size;
             } else {
                 // derive value from output buffer size
-                samples_to_process = std::apply([&](const auto &...ports) { return std::min({ ports.streamWriter().available()..., ports.max_buffer_size()... }); }, output_ports(&self()));
+                samples_to_process = std::apply([&](const auto &...ports) { return std::min({ writable_samples(ports)..., ports.max_buffer_size()... }); }, output_ports(&self()));
                 if (not enough_samples_for_output_ports(samples_to_process)) {
                     return work_return_t::INSUFFICIENT_OUTPUT_ITEMS;
                 }
@@ -527,32 +769,86 @@ public:
             }
             samples_to_process = available_values_count;
             tags_to_process    = available_tags_count;
-            if (not enough_samples_for_output_ports(samples_to_process)) {
+            if constexpr (is_resampling && !is_sink_node) {
+                // limit to the whole input chunks whose outputs fit, otherwise interpolators would stall on large inputs
+                const std::size_t n_writable = std::apply([](const auto &...port) { return std::min({ writable_samples(port)..., port.max_buffer_size()... }); }, output_ports(&self()));
+                samples_to_process           = std::min(samples_to_process, n_writable / Resampling::output_chunk_size * Resampling::input_chunk_size);
+                if (samples_to_process == 0) {
+                    return work_return_t::INSUFFICIENT_OUTPUT_ITEMS;
+                }
+            } else if constexpr (!is_sink_node) {
+                // drop-newest outputs do not wait but only accept the space freed by their readers, the remaining input is processed by the next 'work()' call
+                meta::tuple_for_each(
+                        [&samples_to_process](const auto &output_port) noexcept {
+                            if constexpr (requires { output_port.streamWriter().overflow_policy(); }) {
+                                if (output_port.streamWriter().overflow_policy() == gr::OverflowPolicy::DropNewest) {
+                                    samples_to_process = std::min(samples_to_process, writable_samples(output_port));
+                                }
+                            }
+                        },
+                        output_ports(&self()));
+            }
+            if (not enough_samples_for_output_ports(output_samples_for(samples_to_process))) {
                 return work_return_t::INSUFFICIENT_INPUT_ITEMS;
             }
-            if (not space_available_on_output_ports(samples_to_process)) {
+            if (not space_available_on_output_ports(output_samples_for(samples_to_process))) {
                 return work_return_t::INSUFFICIENT_OUTPUT_ITEMS;
             }
         }
 
-        const auto input_spans   = meta::tuple_transform([samples_to_process](auto &input_port) noexcept { return input_port.streamReader().get(samples_to_process); }, input_ports(&self()));
+        // wrap-aware (two-span) buffers are processed up to their wrap-around point, the remainder in the next work() call
+        // N.B. ports requiring a minimum number of contiguous samples should use mirrored or double-mapped buffers
+        samples_to_process       = std::min(samples_to_process, samples_to_wrap(self()));
+        if constexpr (!is_source_node) {
+            // overlapping windows and N:M nodes: the stream advances by whole hops and input chunks only
+            meta::tuple_for_each([&samples_to_process](auto &input_port) noexcept { samples_to_process -= samples_to_process % std::lcm(input_port.hop_size(), Resampling::input_chunk_size); },
+                                 input_ports(&self()));
+            if (samples_to_process == 0) {
+                return work_return_t::INSUFFICIENT_INPUT_ITEMS;
+            }
+        }
+
+        const auto input_spans   = meta::tuple_transform(
+                [samples_to_process](auto &input_port) noexcept {
+                    // N.B. the last overlapping window extends 'window_size() - hop_size()' samples past the consumed ones
+                    const std::size_t n_window = samples_to_process + input_port.window_size() - input_port.hop_size();
+                    if constexpr (requires { &Derived::process_bulk; } && requires { input_port.streamReader().get_history(n_window); }) {
+                        if (input_port.history_size() > 0) { // look-back: the span starts 'history_size()' samples before the new ones
+                            return input_port.streamReader().get_history(n_window);
+                        }
+                    }
+                    return input_port.streamReader().get(n_window);
+                },
+                input_ports(&self()));
 
-        auto       writers_tuple = meta::tuple_transform([samples_to_process](auto &output_port) noexcept { return output_port.streamWriter().reserve_output_range(samples_to_process); },
+        const std::size_t samples_to_publish = output_samples_for(samples_to_process);
+        auto              writers_tuple      = meta::tuple_transform([samples_to_publish](auto &output_port) noexcept { return output_port.streamWriter().reserve_output_range(samples_to_publish); },
                                                    output_ports(&self()));
+        // drop-newest outputs without enough space return an empty reservation: the node is processed into scratch memory nevertheless,
+        // i.e. the inputs are consumed and sources advance, and the samples are discarded (publishing the empty range is a no-op)
+        const auto output_spans = meta::tuple_transform(
+                [samples_to_publish](auto &output_port, auto &output_range) noexcept { return output_range.empty() && samples_to_publish > 0 ? output_port.discard_span(samples_to_publish) : std::span(output_range); },
+                output_ports(&self()), writers_tuple);
+        // samples dropped by the outputs' overflow policies are announced on the first sample written in this iteration
+        meta::tuple_for_each([](auto &output_port) noexcept { std::ignore = publish_overflow_tag(output_port); }, output_ports(&self()));
 
         _input_tags_present      = false;
         _output_tags_changed     = false;
         bool auto_change         = false;
-        if (tags_to_process) {
+        if (tags_to_process && !batched_tags) {
             property_map merged_tag_map;
             _input_tags_present    = true;
             std::size_t port_index = 0; // TODO absorb this as optional tuple_for_each argument
             meta::tuple_for_each(
                     [&merged_tag_map, &port_index, this](auto &input_port) noexcept {
                         auto tags = input_port.tagReader().get(1_UZ);
-                        if (tags.size() > 0 && (tags[0].index == input_port.streamReader().position() || tags[0].index == -1)) {
+                        const auto tag_offset = tags.size() > 0 ? tags[0].index - input_port.streamReader().position() : 0;
+                        // N.B. tags within the first hop or input chunk are mapped onto the first output sample of this iteration
+                        const std::size_t granule = std::lcm(input_port.hop_size(), Resampling::input_chunk_size);
+                        if (tags.size() > 0 && ((tag_offset >= 0 && static_cast<std::size_t>(tag_offset) < granule) || tags[0].index == -1)) {
                             _tags_at_input[port_index].clear();
-                            for (const auto &[index, map] : tags) {
+                            for (const auto &tag : tags) {
+                                const property_map &map = tag_map(tag);
                                 _tags_at_input[port_index].insert(map.begin(), map.end());
                                 merged_tag_map.insert(map.begin(), map.end());
                             }
@@ -576,6 +872,10 @@ public:
             }
         }
 
+        if constexpr (batched_tags) {
+            collect_tag_batch(samples_to_process);
+        }
+
         const auto forward_tags = [this]() noexcept {
             if (!_output_tags_changed) {
                 return;
@@ -585,13 +885,13 @@ public:
             // meta::tuple_for_each([&port_id, this](auto &output_port) noexcept { publish_tag2(output_port, _tags_at_output[port_id++]); }, output_ports(&self()));
             meta::tuple_for_each(
                     [&port_id, this](auto &output_port) noexcept {
-                        if (_tags_at_output[port_id].empty()) {
-                            port_id++;
+                        if (_tags_at_output[port_id].empty() || !output_port.is_connected()) {
+                            port_id++; // N.B. unconnected outputs do not publish (nor allocate) tags
                             return;
                         }
                         auto data           = output_port.tagWriter().reserve_output_range(1);
                         data[port_id].index = output_port.streamWriter().position();
-                        data[port_id].map   = _tags_at_output[port_id];
+                        set_tag_map(data[port_id], _tags_at_output[port_id]);
                         data.publish(1);
                         port_id++;
                     },
@@ -615,7 +915,7 @@ public:
         // TODO: check here whether a process_one(...) or a bulk access process has been defined, cases:
         // case 1a: N-in->N-out -> process_one(...) -> auto-handling of streaming tags
         // case 1b: N-in->N-out -> process_bulk(<ins...>, <outs...>) -> auto-handling of streaming tags
-        // case 2a: N-in->M-out -> process_bulk(<ins...>, <outs...>) N,M fixed -> aka. interpolator (M>N) or decimator (M<N)
+        // case 2a: N-in->M-out -> process_bulk(<ins...>, <outs...>) N,M fixed via 'ResamplingRatio<N, M>' -> aka. interpolator (M>N) or decimator (M<N)
         // case 2b: N-in->M-out -> process_bulk(<{ins,tag-IO}...>, <{outs,tag-IO}...>) user-level tag handling
         // case 3:  N-in->M-out -> work() N,M arbitrary -> used need to handle the full logic (e.g. PLL algo)
         // case 4:  Python -> map to cases 1-3 and/or dedicated callback
@@ -623,11 +923,18 @@ public:
         // case sources: HW triggered vs. generating data per invocation (generators via Port::MIN)
         // case sinks: HW triggered vs. fixed-size consumer (may block/never finish for insufficient input data and fixed Port::MIN>0)
 
-        if constexpr (requires { &Derived::process_bulk; }) {
+        if constexpr (batched_tags) {
+            const work_return_t ret = process_bulk_batched(input_spans, output_spans, samples_to_process);
+
+            write_to_outputs(samples_to_publish, writers_tuple);
+            const bool success = consume_readers(self(), samples_to_process);
+            forward_tags();
+            return success ? ret : work_return_t::ERROR;
+        } else if constexpr (requires { &Derived::process_bulk; }) {
             const work_return_t ret = std::apply([this](auto... args) { return static_cast<Derived *>(this)->process_bulk(args...); },
-                                                 std::tuple_cat(input_spans, meta::tuple_transform([](auto &output_range) { return std::span(output_range); }, writers_tuple)));
+                                                 std::tuple_cat(input_spans, output_spans));
 
-            write_to_outputs(samples_to_process, writers_tuple);
+            write_to_outputs(samples_to_publish, writers_tuple);
             const bool success = consume_readers(self(), samples_to_process);
             forward_tags();
             return success ? ret : work_return_t::ERROR;
@@ -643,24 +950,73 @@ public:
         if constexpr ((is_sink_node or meta::simdize_size_v<output_simd_types> != 0) and ((is_source_node and requires(Derived &d) {
                                                                                               { d.process_one_simd(width) };
                                                                                           }) or (meta::simdize_size_v<input_simd_types> != 0 and traits::node::can_process_simd<Derived>))) {
-            // SIMD loop
             std::size_t i = 0;
-            for (; i + width <= samples_to_process; i += width) {
-                const auto &results = simdize_tuple_load_and_apply(width, input_spans, i, [&](const auto &...input_simds) { return invoke_process_one_simd(width, input_simds...); });
-                meta::tuple_for_each([i](auto &output_range, const auto &result) { result.copy_to(output_range.data() + i, stdx::element_aligned); }, writers_tuple, results);
-            }
-            simd_epilogue(width, [&](auto w) {
-                if (i + w <= samples_to_process) {
-                    const auto results = simdize_tuple_load_and_apply(w, input_spans, i, [&](auto &&...input_simds) { return invoke_process_one_simd(w, input_simds...); });
-                    meta::tuple_for_each([i](auto &output_range, auto &result) { result.copy_to(output_range.data() + i, stdx::element_aligned); }, writers_tuple, results);
-                    i += w;
+            if constexpr (is_source_node) {
+                // SIMD loop -- N.B. generators advance their state by the requested width, hence the tail uses narrower widths
+                for (; i + width <= samples_to_process; i += width) {
+                    const auto &results = simdize_tuple_load_and_apply(width, input_spans, i, [&](const auto &...input_simds) { return invoke_process_one_simd(width, input_simds...); });
+                    meta::tuple_for_each([i](auto &output_range, const auto &result) { result.copy_to(output_range.data() + i, stdx::element_aligned); }, output_spans, results);
                 }
-            });
+                simd_epilogue(width, [&](auto w) {
+                    if (i + w <= samples_to_process) {
+                        const auto results = simdize_tuple_load_and_apply(w, input_spans, i, [&](auto &&...input_simds) { return invoke_process_one_simd(w, input_simds...); });
+                        meta::tuple_for_each([i](auto &output_range, auto &result) { result.copy_to(output_range.data() + i, stdx::element_aligned); }, output_spans, results);
+                        i += w;
+                    }
+                });
+            } else {
+                // partial vectors (alignment prologue and tail): masked loads/stores, sinks use scalar calls since masked lanes would be consumed
+                const auto process_partial = [&](std::size_t n) {
+                    if constexpr (is_sink_node) {
+                        for (const std::size_t end = i + n; i < end; ++i) {
+                            std::apply([this, i](auto &...inputs) { std::ignore = invoke_process_one(inputs[i]...); }, input_spans);
+                        }
+                    } else {
+                        const auto results = simdize_tuple_masked_load_and_apply(width, input_spans, i, n, [&](const auto &...input_simds) { return invoke_process_one_simd(width, input_simds...); });
+                        meta::tuple_for_each(
+                                [i, n](auto &output_range, const auto &result) {
+                                    using R = std::remove_cvref_t<decltype(result)>;
+                                    stdx::where(simd_first_n_mask<R>(n), result).copy_to(output_range.data() + i, stdx::element_aligned);
+                                },
+                                output_spans, results);
+                        i += n;
+                    }
+                };
+                const auto simd_loop = [&](auto flag) {
+                    for (; i + width <= samples_to_process; i += width) {
+                        const auto &results = simdize_tuple_load_and_apply(width, input_spans, i, [&](const auto &...input_simds) { return invoke_process_one_simd(width, input_simds...); }, flag);
+                        meta::tuple_for_each([i, flag](auto &output_range, const auto &result) { result.copy_to(output_range.data() + i, flag); }, output_spans, results);
+                    }
+                };
+
+                // peeled prologue up to the first vector-aligned sample (of the first output, the first input for sinks)
+                // N.B. usually empty since buffers are allocated aligned (see 'gr::simd_buffer_alignment')
+                std::size_t n_prologue = 0;
+                if constexpr (is_sink_node) {
+                    n_prologue = samples_to_simd_alignment(width, std::get<0>(input_spans));
+                } else {
+                    n_prologue = samples_to_simd_alignment(width, std::get<0>(output_spans));
+                }
+                if (n_prologue > 0 && n_prologue < samples_to_process) {
+                    process_partial(n_prologue);
+                }
+                // main loop: aligned accesses if all streams share the alignment, unaligned otherwise
+                const auto is_aligned = [&width](const auto &...ranges) noexcept { return ((samples_to_simd_alignment(width, ranges) == 0) && ... && true); };
+                const bool aligned    = std::apply([&](const auto &...ranges) { return is_aligned(std::span(ranges).subspan(i)...); }, std::tuple_cat(input_spans, output_spans));
+                if (aligned) {
+                    simd_loop(stdx::vector_aligned);
+                } else {
+                    simd_loop(stdx::element_aligned);
+                }
+                if (i < samples_to_process) {
+                    process_partial(samples_to_process - i);
+                }
+            }
         } else {
             // Non-SIMD loop
             for (std::size_t i = 0; i < samples_to_process; ++i) {
                 const auto results = std::apply([this, i](auto &...inputs) { return invoke_process_one(inputs[i]...); }, input_spans);
-                meta::tuple_for_each([i](auto &output_range, auto &result) { output_range[i] = std::move(result); }, writers_tuple, results);
+                meta::tuple_for_each([i](auto &output_range, auto &result) { output_range[i] = std::move(result); }, output_spans, results);
             }
         }
 
@@ -3,7 +3,9 @@
 
 #include <complex>
 #include <span>
+#include <stdexcept>
 #include <variant>
+#include <vector>
 
 #include "circular_buffer.hpp"
 #include "tag.hpp"
@@ -19,6 +21,10 @@ using supported_type = std::variant<uint8_t, uint32_t, int8_t, int16_t, int32_t,
 
 enum class port_direction_t { INPUT, OUTPUT, ANY }; // 'ANY' only for query and not to be used for port declarations
 enum class connection_result_t { SUCCESS, FAILED };
+enum class connection_mode_t {
+    BLOCKING,    /*!< default: the destination back-pressures the source if it does not keep up */
+    NON_BLOCKING /*!< lossy: the destination never stalls the source and skips forward if overrun, e.g. for GUI/monitoring taps */
+};
 enum class port_type_t {
     STREAM, /*!< used for single-producer-only ond usually synchronous one-to-one or one-to-many communications */
     MESSAGE /*!< used for multiple-producer one-to-one, one-to-many, many-to-one, or many-to-many communications */
@@ -42,8 +48,9 @@ concept Port = requires(T t, const std::size_t n_items) { // dynamic definitions
  * N.B. void* needed for type-erasure/Python compatibility/wrapping
  */
 struct internal_port_buffers {
-    void *streamHandler;
-    void *tagHandler;
+    void             *streamHandler;
+    void             *tagHandler;
+    connection_mode_t mode = connection_mode_t::BLOCKING;
 };
 
 /**
@@ -88,7 +95,7 @@ public:
     using port_tag                  = std::true_type;
 
     template<fixed_string NewName>
-    using with_name     = port<T, NewName, PortType, PortDirection, MIN_SAMPLES, MAX_SAMPLES, BufferType>;
+    using with_name     = port<T, NewName, PortType, PortDirection, MIN_SAMPLES, MAX_SAMPLES, BufferType, TagBufferType>;
 
     using ReaderType    = decltype(std::declval<BufferType>().new_reader());
     using WriterType    = decltype(std::declval<BufferType>().new_writer());
@@ -103,32 +110,137 @@ private:
     std::size_t  _min_samples  = (MIN_SAMPLES == std::dynamic_extent ? 1 : MIN_SAMPLES);
     std::size_t  _max_samples  = MAX_SAMPLES;
     bool         _connected    = false;
+    gr::OverflowPolicy _overflow_policy    = gr::OverflowPolicy::Block; // outputs only
+    std::size_t        _n_dropped_reported = 0;                        // outputs only, see 'take_n_dropped()'
+    bool               _lock_memory        = false;                    // outputs only, see 'lock_buffer_memory()'
+    std::size_t        _history_size       = 0;                        // inputs only, see 'set_history_size(..)'
+    std::size_t        _window_size        = 1;                        // inputs only, see 'set_window(..)'
+    std::size_t        _hop_size           = 1;                        // inputs only, see 'set_window(..)'
+    std::size_t        _buffer_size        = default_buffer_size;      // outputs only, size of the buffers created on connect
+    std::vector<T>     _discarded;                                     // outputs only, see 'discard_span(..)'
+
+    // N.B. unconnected ports hold per-port null handlers (see 'new_io_handler()'), the actual buffers are created by 'connect(..)'
+    IoType    _ioHandler    = new_io_handler();
+    TagIoType _tagIoHandler = new_tag_io_handler();
+
+    /**
+     * @brief minimal heap-allocated (i.e. neither double-mapped nor shared) buffer backing the handlers of an unconnected port
+     */
+    template<gr::Buffer Type, typename ValueType>
+    [[nodiscard]] static Type
+    new_null_buffer(std::size_t size) {
+        if constexpr (std::is_constructible_v<Type, std::size_t, std::pmr::polymorphic_allocator<ValueType>>) {
+            return Type(size, std::pmr::polymorphic_allocator<ValueType>(std::pmr::new_delete_resource()));
+        } else {
+            return Type(size);
+        }
+    }
 
-    IoType       _ioHandler    = new_io_handler();
-    TagIoType    _tagIoHandler = new_tag_io_handler();
+    template<gr::Buffer Type>
+    [[nodiscard]] Type
+    new_buffer(std::size_t min_size, gr::OverflowPolicy overflow_policy) const {
+        Type buffer = [&] {
+            if constexpr (std::is_constructible_v<Type, std::size_t, gr::OverflowPolicy>) {
+                return Type(min_size, overflow_policy);
+            } else {
+                return Type(min_size); // N.B. buffer type without overflow policies -> always blocking
+            }
+        }();
+        if constexpr (requires { buffer.lock_memory(); }) {
+            if (_lock_memory) {
+                std::ignore = buffer.lock_memory();
+            }
+        }
+        return buffer;
+    }
+
+    // N.B. the tag buffer overwrites its oldest tags for any non-blocking stream policy so that the overflow tag gets through
+    [[nodiscard]] constexpr gr::OverflowPolicy
+    tag_overflow_policy() const noexcept {
+        if (_overflow_policy == gr::OverflowPolicy::Block) {
+            return gr::OverflowPolicy::Block;
+        }
+        if constexpr (requires { TagBufferType::supports_overflow_policy(gr::OverflowPolicy::DropOldest); }) {
+            if (!TagBufferType::supports_overflow_policy(gr::OverflowPolicy::DropOldest)) {
+                return gr::OverflowPolicy::DropNewest; // N.B. multi-producer tag buffer
+            }
+        }
+        return gr::OverflowPolicy::DropOldest;
+    }
+
+    // outputs: replaces the null handlers by writers of the actual buffers once being connected (no-op if already connected)
+    void
+    create_connected_handlers() noexcept {
+        static_assert(IS_OUTPUT, "only to be used with output ports");
+        if (_connected) {
+            return;
+        }
+        _ioHandler    = new_buffer<BufferType>(connected_buffer_size(_buffer_size), _overflow_policy).new_writer();
+        _tagIoHandler = new_buffer<TagBufferType>(connected_buffer_size(_buffer_size), tag_overflow_policy()).new_writer();
+        _connected    = true;
+        reserve_discarded();
+    }
+
+    // drop-newest outputs: allocates the scratch memory of dropped reservations up-front, their size is bounded by the buffer size
+    void
+    reserve_discarded() {
+        if (_overflow_policy == gr::OverflowPolicy::DropNewest && _discarded.size() < _ioHandler.buffer().size()) {
+            _discarded.resize(_ioHandler.buffer().size());
+        }
+    }
+
+    // inputs: the look-back and windows need to fit into the buffer, i.e. the writer is gated on 'position - history_size' and needs
+    // space for at least one hop beyond the 'window_size - hop_size' overlap, and to be contiguous, i.e. the two-span mode would cut
+    // them at the wrap-around point
+    template<typename Buffer>
+    [[nodiscard]] static bool
+    fits_buffer(const Buffer &buffer, std::size_t history_size, std::size_t window_size) noexcept {
+        if (history_size >= buffer.size() || window_size > buffer.size() - history_size) {
+            return false;
+        }
+        if constexpr (requires { buffer.wrap_mode(); }) {
+            return (history_size == 0 && window_size == 1) || buffer.wrap_mode() != gr::WrapMode::Split;
+        } else {
+            return true;
+        }
+    }
+
+    // N.B. the buffer needs to hold at least 'min_buffer_size()' samples, a smaller one would never satisfy the port's minimum
+    [[nodiscard]] constexpr std::size_t
+    connected_buffer_size(std::size_t requested_size) const noexcept {
+        return std::max(requested_size, min_buffer_size());
+    }
 
 public:
+    static constexpr std::size_t default_buffer_size = 65536;
+    static constexpr std::size_t null_buffer_size    = std::max(4096UL / sizeof(T), 1UL); // unconnected outputs: samples per 'work()' call
+
+    /**
+     * @return the handler of unconnected ports: readers of a never written-to buffer (inputs), respectively writers of a
+     * small buffer w/o readers (outputs) into which 'process_bulk(..)' etc. still may write. N.B. one buffer per port
+     */
     [[nodiscard]] constexpr auto
     new_io_handler() const noexcept {
         if constexpr (IS_INPUT) {
-            return BufferType(65536).new_reader();
+            return new_null_buffer<BufferType, T>(1).new_reader();
         } else {
-            return BufferType(65536).new_writer();
+            return new_null_buffer<BufferType, T>(null_buffer_size).new_writer();
         }
     }
 
     [[nodiscard]] constexpr auto
     new_tag_io_handler() const noexcept {
         if constexpr (IS_INPUT) {
-            return TagBufferType(65536).new_reader();
+            return new_null_buffer<TagBufferType, tag_t>(1).new_reader();
         } else {
-            return TagBufferType(65536).new_writer();
+            return new_null_buffer<TagBufferType, tag_t>(1).new_writer(); // N.B. tags of unconnected outputs are not published
         }
     }
 
     [[nodiscard]] internal_port_buffers
     writer_handler_internal() noexcept {
         static_assert(IS_OUTPUT, "only to be used with output ports");
+        create_connected_handlers();
         return { static_cast<void *>(std::addressof(_ioHandler)), static_cast<void *>(std::addressof(_tagIoHandler)) };
     }
 
@@ -149,7 +261,13 @@ public:
         //       (std::any could be a viable approach)
         auto typed_buffer_writer     = static_cast<WriterType *>(buffer_writer_handler_other.streamHandler);
         auto typed_tag_buffer_writer = static_cast<TagWriterType *>(buffer_writer_handler_other.tagHandler);
-        setBuffer(typed_buffer_writer->buffer(), typed_tag_buffer_writer->buffer());
+        if (typed_buffer_writer->buffer().size() < min_buffer_size()) {
+            return false; // N.B. the port's minimum number of samples would never become available
+        }
+        if (!fits_buffer(typed_buffer_writer->buffer(), _history_size, _window_size)) {
+            return false;
+        }
+        setBuffer(typed_buffer_writer->buffer(), typed_tag_buffer_writer->buffer(), buffer_writer_handler_other.mode);
         return true;
     }
 
@@ -165,7 +283,17 @@ public:
         static_assert(PortName.empty(), "port name must be exclusively declared via NTTP or constructor parameter");
     }
 
-    constexpr port(port &&other) noexcept : _name(std::move(other._name)), _priority{ other._priority }, _min_samples(other._min_samples), _max_samples(other._max_samples) {}
+    constexpr port(port &&other) noexcept
+        : _name(std::move(other._name))
+        , _priority{ other._priority }
+        , _min_samples(other._min_samples)
+        , _max_samples(other._max_samples)
+        , _overflow_policy(other._overflow_policy)
+        , _lock_memory(other._lock_memory)
+        , _history_size(other._history_size)
+        , _window_size(other._window_size)
+        , _hop_size(other._hop_size)
+        , _buffer_size(other._buffer_size) {}
 
     constexpr port &
     operator=(port &&other) {
@@ -175,6 +303,13 @@ public:
         std::swap(_min_samples, tmp._min_samples);
         std::swap(_max_samples, tmp._max_samples);
         std::swap(_connected, tmp._connected);
+        std::swap(_overflow_policy, tmp._overflow_policy);
+        std::swap(_n_dropped_reported, tmp._n_dropped_reported);
+        std::swap(_lock_memory, tmp._lock_memory);
+        std::swap(_history_size, tmp._history_size);
+        std::swap(_window_size, tmp._window_size);
+        std::swap(_hop_size, tmp._hop_size);
+        std::swap(_buffer_size, tmp._buffer_size);
         std::swap(_ioHandler, tmp._ioHandler);
         std::swap(_tagIoHandler, tmp._tagIoHandler);
         return *this;
@@ -216,6 +351,11 @@ public:
         return _priority;
     }
 
+    [[nodiscard]] constexpr bool
+    is_connected() const noexcept {
+        return _connected;
+    }
+
     [[nodiscard]] constexpr static std::size_t
     available() noexcept {
         return 0;
@@ -239,14 +379,43 @@ public:
         }
     }
 
+    /**
+     * @brief replaces the output buffer by one of at least 'min_size' (and 'min_buffer_size()') samples (no-op for input ports).
+     *
+     * Buffers supporting an online resize keep the not yet consumed samples and tags, and the connected input ports follow
+     * the new buffer on their next access. Needs to be called while the node is not executing 'work()', e.g. while the
+     * scheduler is paused. Other buffer types are replaced by a new, empty one. Unconnected outputs use 'min_size' once connected.
+     * @return FAILED if the unconsumed samples do not fit into the new buffer, in which case the old one remains in use
+     */
     [[nodiscard]] constexpr connection_result_t
     resize_buffer(std::size_t min_size) noexcept {
         if constexpr (IS_INPUT) {
             return connection_result_t::SUCCESS;
         } else {
             try {
-                _ioHandler    = BufferType(min_size).new_writer();
-                _tagIoHandler = TagBufferType(min_size).new_writer();
+                if (!_connected) {
+                    _buffer_size = min_size; // N.B. applied once being connected
+                    return connection_result_t::SUCCESS;
+                }
+                if constexpr (requires(WriterType &writer, TagWriterType &tag_writer) {
+                                  writer.resize(min_size);
+                                  tag_writer.resize(min_size);
+                              }) {
+                    _ioHandler.resize(connected_buffer_size(min_size));
+                    _buffer_size = min_size;
+                    reserve_discarded();
+                    try {
+                        _tagIoHandler.resize(connected_buffer_size(min_size));
+                    } catch (const std::length_error &) {
+                        // N.B. more pending tags than the new size: keep the tag buffer rather than losing tags
+                    }
+                    return connection_result_t::SUCCESS;
+                }
+                _buffer_size        = min_size;
+                _ioHandler          = new_buffer<BufferType>(connected_buffer_size(min_size), _overflow_policy).new_writer();
+                _tagIoHandler       = new_buffer<TagBufferType>(connected_buffer_size(min_size), tag_overflow_policy()).new_writer();
+                _n_dropped_reported = 0;
+                reserve_discarded();
             } catch (...) {
                 return connection_result_t::FAILED;
             }
@@ -254,6 +423,141 @@ public:
         return connection_result_t::SUCCESS;
     }
 
+    [[nodiscard]] constexpr gr::OverflowPolicy
+    overflow_policy() const noexcept {
+        return _overflow_policy;
+    }
+
+    /**
+     * @brief sets the behaviour of an output port if its readers do not keep up (default: block), e.g. for hardware-clocked
+     * sources that must not block. Dropped samples are announced downstream via a 'tag::N_DROPPED' tag (see 'publish_overflow_tag(..)').
+     * N.B. needs to be set before the port is connected, drop-oldest requires a single-producer buffer type
+     */
+    [[nodiscard]] connection_result_t
+    set_overflow_policy(gr::OverflowPolicy overflow_policy) noexcept {
+        static_assert(IS_OUTPUT, "overflow policies are only applicable to outputs");
+        if (_connected) {
+            return connection_result_t::FAILED;
+        }
+        if constexpr (requires { BufferType::supports_overflow_policy(overflow_policy); }) {
+            if (!BufferType::supports_overflow_policy(overflow_policy)) {
+                return connection_result_t::FAILED;
+            }
+        }
+        _overflow_policy    = overflow_policy; // N.B. applied to the buffers created on connect
+        _n_dropped_reported = 0;
+        return connection_result_t::SUCCESS;
+    }
+
+    /**
+     * @brief prefaults and pins (mlock) the output's stream and tag buffers, e.g. to avoid the page faults of the first
+     * pass after start-up. Buffers that are allocated later on (e.g. by 'resize_buffer(..)') are pinned as well.
+     * N.B. no-op for inputs, their memory belongs to the upstream output
+     */
+    gr::memory_lock_result
+    lock_buffer_memory() noexcept {
+        gr::memory_lock_result result;
+        if constexpr (IS_OUTPUT) {
+            _lock_memory = true;
+            if (!_connected) {
+                return result; // N.B. the buffers created on connect are pinned
+            }
+            if constexpr (requires(BufferType buffer) { buffer.lock_memory(); }) {
+                result += _ioHandler.buffer().lock_memory();
+            }
+            if constexpr (requires(TagBufferType buffer) { buffer.lock_memory(); }) {
+                result += _tagIoHandler.buffer().lock_memory();
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @return scratch memory of 'n_samples' into which the samples of a dropped (drop-newest) output reservation are
+     * written and discarded, i.e. the node still processes its inputs. N.B. allocation-free, the memory is reserved when
+     * being connected (resized) for up to the buffer size, i.e. the largest possible reservation
+     */
+    [[nodiscard]] std::span<T>
+    discard_span(std::size_t n_samples) noexcept {
+        static_assert(IS_OUTPUT, "discard_span() not applicable for inputs");
+        assert(n_samples <= _discarded.size() && "reservation exceeds the buffer size");
+        return { _discarded.data(), n_samples };
+    }
+
+    /**
+     * @return number of samples dropped by the output buffer's overflow policy since the last call
+     */
+    [[nodiscard]] std::size_t
+    take_n_dropped() noexcept {
+        static_assert(IS_OUTPUT, "take_n_dropped() not applicable for inputs");
+        if constexpr (requires { std::declval<WriterType>().n_dropped(); }) {
+            const std::size_t n_dropped = _ioHandler.n_dropped();
+            return n_dropped - std::exchange(_n_dropped_reported, n_dropped);
+        } else {
+            return 0;
+        }
+    }
+
+    [[nodiscard]] constexpr std::size_t
+    history_size() const noexcept {
+        return _history_size;
+    }
+
+    /**
+     * @brief declares a look-back of 'n_samples' already consumed samples that remain readable in front of the new ones
+     * (see 'BufferReader::get_history(..)'), e.g. for FIR filters or correlators to read their history in-place rather
+     * than copying each sample into a private history buffer. The upstream writer is gated on 'position - n_samples'.
+     * Nodes implementing 'process_bulk(..)' receive input spans that start 'history_size()' samples before the new ones.
+     * N.B. needs to be set before the port is connected. Connecting fails if the look-back (plus window, see 'set_window(..)') does
+     * not fit into the buffer, i.e. the writer would never get space, or the buffer is a wrap-aware two-span buffer (gr::WrapMode::Split)
+     */
+    [[nodiscard]] connection_result_t
+    set_history_size(std::size_t n_samples) noexcept {
+        static_assert(IS_INPUT, "look-back is only applicable to inputs");
+        if constexpr (!requires(BufferType buffer) { buffer.new_reader(gr::ReaderMode::Gating, std::size_t{}); }) {
+            return n_samples == 0 ? connection_result_t::SUCCESS : connection_result_t::FAILED; // N.B. buffer type w/o look-back
+        } else {
+            if (_connected) {
+                return connection_result_t::FAILED;
+            }
+            _history_size = n_samples;
+            return connection_result_t::SUCCESS;
+        }
+    }
+
+    [[nodiscard]] constexpr std::size_t
+    window_size() const noexcept {
+        return _window_size;
+    }
+
+    [[nodiscard]] constexpr std::size_t
+    hop_size() const noexcept {
+        return _hop_size;
+    }
+
+    /**
+     * @brief declares overlapping windows of 'window_size' samples each advancing the stream by 'hop_size' samples, e.g.
+     * 4096/1024 for STFTs/spectrograms. 'node::work()' then processes only complete windows and consumes whole hops:
+     * for 'k' hops, 'process_bulk(..)' receives 'k * hop_size + window_size - hop_size' input samples (window 'j' starting
+     * at 'j * hop_size') and 'k * hop_size' output samples -- w/o copying the overlapping samples.
+     * N.B. default: 'window_size == hop_size == 1', i.e. plain streaming. Windows must fit into the buffer (incl. the look-back
+     * 'history_size()') and are not supported by wrap-aware two-span buffers (gr::WrapMode::Split) since they would be cut at the
+     * wrap-around point, i.e. 'FAILED' if the connected buffer does not meet these (connecting such a buffer to a windowed input fails likewise)
+     */
+    [[nodiscard]] connection_result_t
+    set_window(std::size_t window_size, std::size_t hop_size) noexcept {
+        static_assert(IS_INPUT, "windows are only applicable to inputs");
+        if (hop_size == 0 || hop_size > window_size) {
+            return connection_result_t::FAILED;
+        }
+        if (_connected && !fits_buffer(_ioHandler.buffer(), _history_size, window_size)) {
+            return connection_result_t::FAILED;
+        }
+        _window_size = window_size;
+        _hop_size    = hop_size;
+        return connection_result_t::SUCCESS;
+    }
+
     [[nodiscard]] auto
     buffer() {
         struct port_buffers {
@@ -261,18 +565,32 @@ public:
             TagBufferType tagBufferType;
         };
 
+        if constexpr (IS_OUTPUT) {
+            create_connected_handlers(); // N.B. buffers are exposed to be read from
+        }
         return port_buffers{ _ioHandler.buffer(), _tagIoHandler.buffer() };
     }
 
     void
-    setBuffer(gr::Buffer auto streamBuffer, gr::Buffer auto tagBuffer) noexcept {
+    setBuffer(gr::Buffer auto streamBuffer, gr::Buffer auto tagBuffer, connection_mode_t mode = connection_mode_t::BLOCKING) noexcept {
         if constexpr (IS_INPUT) {
-            _ioHandler    = std::move(streamBuffer.new_reader());
-            _tagIoHandler = std::move(tagBuffer.new_reader());
+            const auto new_reader = [mode](auto &buffer, std::size_t history_size) {
+                const auto reader_mode = mode == connection_mode_t::NON_BLOCKING ? gr::ReaderMode::Monitor : gr::ReaderMode::Gating;
+                if constexpr (requires { buffer.new_reader(reader_mode, history_size); }) {
+                    return buffer.new_reader(reader_mode, history_size);
+                } else if constexpr (requires { buffer.new_reader(reader_mode); }) {
+                    return buffer.new_reader(reader_mode);
+                } else {
+                    return buffer.new_reader(); // N.B. buffer type without non-gating readers
+                }
+            };
+            _ioHandler    = new_reader(streamBuffer, _history_size);
+            _tagIoHandler = new_reader(tagBuffer, 0_UZ);
             _connected    = true;
         } else {
             _ioHandler    = std::move(streamBuffer.new_writer());
-            _tagIoHandler = std::move(tagBuffer.new_reader());
+            _tagIoHandler = std::move(tagBuffer.new_writer());
+            _connected    = true;
         }
     }
 
@@ -337,10 +655,18 @@ public:
 
     template<typename Other>
     [[nodiscard]] connection_result_t
-    connect(Other &&other) {
+    connect(Other &&other, connection_mode_t mode = connection_mode_t::BLOCKING) {
         static_assert(IS_OUTPUT && std::remove_cvref_t<Other>::IS_INPUT);
-        auto src_buffer = writer_handler_internal();
-        return std::forward<Other>(other).update_reader_internal(src_buffer) ? connection_result_t::SUCCESS : connection_result_t::FAILED;
+        const bool was_connected = _connected;
+        auto       src_buffer    = writer_handler_internal();
+        src_buffer.mode          = mode;
+        if (std::forward<Other>(other).update_reader_internal(src_buffer)) {
+            return connection_result_t::SUCCESS;
+        }
+        if (!was_connected) {
+            std::ignore = disconnect(); // N.B. rejected by the input: w/o readers, the output falls back to its null handlers
+        }
+        return connection_result_t::FAILED;
     }
 
     friend class dynamic_port;
@@ -386,24 +712,44 @@ static_assert(OUT_MSG<float, 0, 0, "out_msg">::with_name<"out_message">::static_
 
 constexpr void
 publish_tag(Port auto &port, property_map &&tag_data, std::size_t tag_offset = 0) noexcept {
+    if (!port.is_connected()) {
+        return; // nobody to receive the tag
+    }
     port.tagWriter().publish(
-            [&port, data = std::move(tag_data), &tag_offset](std::span<fair::graph::tag_t> tag_output) {
+            [&port, data = std::move(tag_data), &tag_offset](auto &tag_output) mutable {
                 tag_output[0].index = port.streamWriter().position() + std::make_signed_t<std::size_t>(tag_offset);
-                tag_output[0].map   = std::move(data);
+                set_tag_map(tag_output[0], std::move(data));
             },
             1_UZ);
 }
 
 constexpr void
 publish_tag(Port auto &port, const property_map &tag_data, std::size_t tag_offset = 0) noexcept {
+    if (!port.is_connected()) {
+        return; // nobody to receive the tag
+    }
     port.tagWriter().publish(
-            [&port, &tag_data, &tag_offset](std::span<fair::graph::tag_t> tag_output) {
+            [&port, &tag_data, &tag_offset](auto &tag_output) {
                 tag_output[0].index = port.streamWriter().position() + tag_offset;
-                tag_output[0].map   = tag_data;
+                set_tag_map(tag_output[0], tag_data);
             },
             1_UZ);
 }
 
+/**
+ * @brief publishes a 'tag::N_DROPPED' tag on the next sample to be written if the output port's overflow policy dropped
+ * samples since the last call -- to be called by (source) nodes implementing their own 'work()' before publishing new data
+ * @return number of dropped samples that have been announced
+ */
+constexpr std::size_t
+publish_overflow_tag(Port auto &port) noexcept {
+    const std::size_t n_dropped = port.take_n_dropped();
+    if (n_dropped > 0) {
+        publish_tag(port, property_map{ tag::N_DROPPED(static_cast<uint64_t>(n_dropped)) });
+    }
+    return n_dropped;
+}
+
 } // namespace fair::graph
 
 #endif // include guard
@@ -40,6 +40,14 @@ class simple : public node<simple> {
 public:
     explicit simple(fair::graph::graph &&graph) : _init{ fair::graph::scheduler::init(graph) }, _graph(std::move(graph)) {}
 
+    /**
+     * @brief the scheduled graph, e.g. to resize buffers while the scheduler is paused (i.e. not within 'work()')
+     */
+    [[nodiscard]] fair::graph::graph &
+    graph() noexcept {
+        return _graph;
+    }
+
     work_return_t
     work() {
         if (!_init) {
@@ -115,6 +123,14 @@ public:
         }
     }
 
+    /**
+     * @brief the scheduled graph, e.g. to resize buffers while the scheduler is paused (i.e. not within 'work()')
+     */
+    [[nodiscard]] fair::graph::graph &
+    graph() noexcept {
+        return _graph;
+    }
+
     work_return_t
     work() {
         if (!_init) {
@@ -2,11 +2,15 @@
 #define GNURADIO_SEQUENCE_HPP
 
 #include <algorithm>
+#include <array>
 #include <atomic>
+#include <bit>
+#include <concepts>
 #include <cstdint>
 #include <limits>
 #include <memory>
 #include <ranges>
+#include <utility>
 #include <vector>
 
 namespace gr {
@@ -80,6 +84,178 @@ public:
     }
 };
 
+/**
+ * Lock-free registry of (reader) sequences that stores the sequence values contiguously rather than each in its own
+ * heap-allocated and cache-line-padded 'Sequence'. The values are packed (i.e. 8 per cache line) into fixed-size blocks
+ * of 64 slots, which allows writers to compute the minimum gating sequence with a linear, branch-free scan instead of
+ * a pointer chase per reader. Slots are claimed/released lock-free via an atomic occupancy bit-mask per block. Released
+ * slots hold 'max()' so that they never gate, further blocks are appended (and only released with the table) as needed.
+ *
+ * N.B. each slot is owned by a single reader: updating its value is a plain (release) store and not a read-modify-write.
+ */
+class SequenceTable
+{
+public:
+    using signed_index_type = Sequence::signed_index_type;
+    static constexpr std::size_t kBlockSize = 64; // N.B. number of bits of the occupancy mask
+    static constexpr signed_index_type kUnused = std::numeric_limits<signed_index_type>::max();
+    static_assert(kBlockSize % 4 == 0, "getMinimum() scans in strides of four");
+
+private:
+    struct alignas(hardware_destructive_interference_size) Block {
+        std::array<std::atomic<signed_index_type>, kBlockSize> values;
+        alignas(hardware_destructive_interference_size) std::atomic<std::uint64_t> occupied{ 0 };
+        std::atomic<std::size_t> used{ 0 }; // high-water mark of claimed slots -> limits the scan
+        std::atomic<Block*> next{ nullptr };
+
+        Block() noexcept { for (auto& value : values) { value.store(kUnused, std::memory_order_relaxed); } }
+    };
+    Block _head;
+
+public:
+    /**
+     * handle to a claimed slot, provides the same value interface as 'Sequence'
+     */
+    class Slot {
+        Block* _block = nullptr;
+        std::size_t _index = 0;
+        friend class SequenceTable;
+        Slot(Block* block, std::size_t index) noexcept : _block(block), _index(index) {}
+        [[nodiscard]] forceinline std::atomic<signed_index_type>& atomic() const noexcept { return _block->values[_index]; }
+
+    public:
+        Slot() noexcept = default;
+        Slot(const Slot&) = delete;
+        Slot& operator=(const Slot&) = delete;
+        Slot(Slot&& other) noexcept : _block(std::exchange(other._block, nullptr)), _index(std::exchange(other._index, 0)) {}
+        Slot& operator=(Slot&& other) noexcept { std::swap(_block, other._block); std::swap(_index, other._index); return *this; }
+
+        [[nodiscard]] explicit operator bool() const noexcept { return _block != nullptr; }
+        [[nodiscard]] const void* id() const noexcept { return _block == nullptr ? nullptr : &atomic(); } // identity, see 'forEachClaimed(..)'
+        [[nodiscard]] forceinline signed_index_type value() const noexcept { return atomic().load(std::memory_order_acquire); }
+        forceinline void setValue(const signed_index_type value) noexcept { atomic().store(value, std::memory_order_release); }
+        [[nodiscard]] forceinline signed_index_type addAndGet(signed_index_type value) noexcept {
+            const signed_index_type newValue = atomic().load(std::memory_order_relaxed) + value; // single owner -> no RMW needed
+            atomic().store(newValue, std::memory_order_release);
+            return newValue;
+        }
+        [[nodiscard]] forceinline bool compareAndSet(signed_index_type expectedSequence, signed_index_type nextSequence) noexcept {
+            return atomic().compare_exchange_strong(expectedSequence, nextSequence, std::memory_order_acq_rel);
+        }
+    };
+
+    SequenceTable() noexcept = default;
+    SequenceTable(const SequenceTable&) = delete;
+    SequenceTable& operator=(const SequenceTable&) = delete;
+    ~SequenceTable() {
+        for (Block* block = _head.next.load(std::memory_order_acquire); block != nullptr;) {
+            delete std::exchange(block, block->next.load(std::memory_order_relaxed));
+        }
+    }
+
+    /**
+     * claims a new slot initialised to the cursor (i.e. write) position
+     */
+    [[nodiscard]] Slot add(const Sequence& cursor) {
+        for (Block* block = &_head;;) {
+            std::uint64_t occupied = block->occupied.load(std::memory_order_acquire);
+            while (occupied != ~std::uint64_t{ 0 }) {
+                const auto index = static_cast<std::size_t>(std::countr_one(occupied));
+                if (block->occupied.compare_exchange_weak(occupied, occupied | (std::uint64_t{ 1 } << index), std::memory_order_acq_rel)) {
+                    Slot slot(block, index);
+                    slot.setValue(cursor.value());
+                    for (std::size_t used = block->used.load(std::memory_order_relaxed); used < index + 1 && !block->used.compare_exchange_weak(used, index + 1, std::memory_order_acq_rel);) { }
+                    slot.setValue(cursor.value()); // N.B. the cursor may have moved while the slot was being published
+                    return slot;
+                }
+            }
+            Block* next = block->next.load(std::memory_order_acquire);
+            if (next == nullptr) {
+                auto* newBlock = new Block();
+                if (block->next.compare_exchange_strong(next, newBlock, std::memory_order_acq_rel)) {
+                    next = newBlock;
+                } else {
+                    delete newBlock; // another thread appended a block concurrently
+                }
+            }
+            block = next;
+        }
+    }
+
+    /**
+     * releases the slot, the handle is reset
+     * @return false if the handle was empty
+     */
+    bool remove(Slot& slot) noexcept {
+        if (!slot) {
+            return false;
+        }
+        slot.setValue(kUnused);
+        slot._block->occupied.fetch_and(~(std::uint64_t{ 1 } << slot._index), std::memory_order_acq_rel);
+        slot = Slot();
+        return true;
+    }
+
+    /**
+     * @return the minimum of all registered sequences, or 'minimum' if none is smaller
+     */
+    [[nodiscard]] signed_index_type getMinimum(signed_index_type minimum = kUnused) const noexcept {
+        for (const Block* block = &_head; block != nullptr; block = block->next.load(std::memory_order_acquire)) {
+            const std::size_t used = (block->used.load(std::memory_order_acquire) + 3UL) & ~3UL;
+            // branch-free with four independent accumulators, unused slots hold kUnused (N.B. kBlockSize is a multiple of 4)
+            signed_index_type m[4] = { minimum, minimum, minimum, minimum };
+            for (std::size_t i = 0; i < used; i += 4) {
+                m[0] = std::min(m[0], block->values[i + 0].load(std::memory_order_relaxed));
+                m[1] = std::min(m[1], block->values[i + 1].load(std::memory_order_relaxed));
+                m[2] = std::min(m[2], block->values[i + 2].load(std::memory_order_relaxed));
+                m[3] = std::min(m[3], block->values[i + 3].load(std::memory_order_relaxed));
+            }
+            minimum = std::min(std::min(m[0], m[1]), std::min(m[2], m[3]));
+        }
+        std::atomic_thread_fence(std::memory_order_acquire); // pairs with the release store in Slot::setValue
+        return minimum;
+    }
+
+    /**
+     * moves all registered sequences that lag behind 'target' forward to 'target' (e.g. to overwrite the oldest samples)
+     * N.B. owners of slots that may be advanced need to use 'Slot::compareAndSet(..)' rather than 'addAndGet(..)'
+     */
+    void advanceTo(const signed_index_type target) noexcept {
+        for (Block* block = &_head; block != nullptr; block = block->next.load(std::memory_order_acquire)) {
+            const std::size_t used = block->used.load(std::memory_order_acquire);
+            for (std::size_t i = 0; i < used; i++) {
+                auto& value = block->values[i];
+                // N.B. released slots hold 'kUnused' and are thus never advanced
+                for (signed_index_type current = value.load(std::memory_order_acquire); current < target && !value.compare_exchange_weak(current, target, std::memory_order_acq_rel);) { }
+            }
+        }
+    }
+
+    /**
+     * invokes 'fn(id, value)' for each claimed slot, 'id' matches the slot handle's 'Slot::id()'
+     * N.B. not synchronised with concurrent 'add(..)'/'remove(..)' calls
+     */
+    template<std::invocable<const void*, signed_index_type> Fn>
+    void forEachClaimed(Fn&& fn) const {
+        for (const Block* block = &_head; block != nullptr; block = block->next.load(std::memory_order_acquire)) {
+            for (std::uint64_t occupied = block->occupied.load(std::memory_order_acquire); occupied != 0; occupied &= occupied - 1) {
+                const auto index = static_cast<std::size_t>(std::countr_zero(occupied));
+                fn(static_cast<const void*>(&block->values[index]), block->values[index].load(std::memory_order_acquire));
+            }
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        std::size_t count = 0;
+        for (const Block* block = &_head; block != nullptr; block = block->next.load(std::memory_order_acquire)) {
+            count += static_cast<std::size_t>(std::popcount(block->occupied.load(std::memory_order_acquire)));
+        }
+        return count;
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+};
+
 namespace detail {
 
 using signed_index_type = Sequence::signed_index_type;
@@ -105,6 +281,10 @@ inline signed_index_type getMinimumSequence(
     return minimum;
 }
 
+inline signed_index_type getMinimumSequence(const SequenceTable& sequences, signed_index_type minimum = std::numeric_limits<signed_index_type>::max()) noexcept {
+    return sequences.getMinimum(minimum);
+}
+
 inline void addSequences(std::shared_ptr<std::vector<std::shared_ptr<Sequence>>>& sequences,
              const Sequence& cursor,
              const std::vector<std::shared_ptr<Sequence>>& sequencesToAdd)
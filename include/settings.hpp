@@ -1,15 +1,23 @@
 #ifndef GRAPH_PROTOTYPE_SETTINGS_HPP
 #define GRAPH_PROTOTYPE_SETTINGS_HPP
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <concepts>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <reflection.hpp>
 #include <set>
+#include <span>
+#include <string_view>
 #include <tag.hpp>
+#include <typelist.hpp>
 #include <variant>
+#include <vector>
 
 namespace fair::graph {
 
@@ -18,6 +26,19 @@ struct SettingsCtx {
     using TimePoint               = std::chrono::time_point<std::chrono::system_clock>;
     std::optional<TimePoint> time = std::nullopt; /// UTC time-stamp from which the setting is valid
     property_map             context;             /// user-defined multiplexing context for which the setting is valid
+
+    /**
+     * @return the name of the multiplexing context, i.e. the 'tag::CONTEXT' entry of 'context', if any (N.B. refers to 'context')
+     */
+    [[nodiscard]] std::optional<std::string_view>
+    context_name() const noexcept {
+        if (const auto it = context.find(tag::CONTEXT.key()); it != context.end()) {
+            if (const auto *name = std::get_if<std::string>(&it->second)) {
+                return *name;
+            }
+        }
+        return std::nullopt;
+    }
 };
 
 template<typename T>
@@ -30,6 +51,8 @@ concept Settings = requires(T t, std::span<const std::string> parameter_keys, co
     /**
      * @brief stages new key-value pairs that shall replace the block field-based settings.
      * N.B. settings become only active after executing 'apply_staged_parameters()' (usually done early on in the 'node::work()' function)
+     * With a 'tag::CONTEXT' entry in 'ctx.context', the values are stored for that multiplexing context and become active
+     * once a 'tag::CONTEXT' tag switches the node to it.
      * @return key-value pairs that could not be set
      */
     { t.set(parameters, ctx) } -> std::same_as<property_map>;
@@ -38,6 +61,7 @@ concept Settings = requires(T t, std::span<const std::string> parameter_keys, co
     /**
      * @brief updates parameters based on node input tags for those with keys stored in `auto_update_parameters()`
      * Parameter changes to down-stream nodes is controlled via `auto_forward_parameters()`
+     * A 'tag::CONTEXT' entry switches to the settings previously stored for that multiplexing context.
      */
     { t.auto_update(parameters, ctx) } -> std::same_as<void>;
     { t.auto_update(parameters) } -> std::same_as<void>;
@@ -160,14 +184,135 @@ struct settings_base {
             = 0;
 };
 
+namespace detail {
+
+/**
+ * @brief compile-time table of the node's settable fields (i.e. writable arithmetic, string, and vector members) sorted by
+ * their display name: a key is mapped via binary search straight onto the field's type-check and assignment functions.
+ * This replaces iterating over all reflected members and constructing a 'std::string' per member for each key.
+ * A second table holds the readable fields from which the active settings are refreshed.
+ */
+template<typename Node>
+class settings_dispatch {
+    template<typename Member>
+    using field_type = unwrap_if_wrapped_t<std::remove_cvref_t<typename Member::value_type>>;
+
+    template<typename Member>
+    static constexpr bool
+    is_settable() noexcept {
+        if constexpr (refl::trait::is_field_v<Member>) {
+            using Type = field_type<Member>;
+            return refl::descriptor::is_writable(Member{}) && (std::is_arithmetic_v<Type> || std::is_same_v<Type, std::string> || fair::meta::vector_type<Type>);
+        } else {
+            return false;
+        }
+    }
+
+    template<typename Member>
+    using is_settable_field = std::bool_constant<is_settable<Member>()>;
+
+    template<typename Member>
+    static constexpr bool
+    is_readable() noexcept {
+        if constexpr (refl::trait::is_field_v<Member>) {
+            using Type = field_type<Member>;
+            return refl::descriptor::is_readable(Member{}) && (std::integral<Type> || std::floating_point<Type> || std::is_same_v<Type, std::string> || fair::meta::vector_type<Type>);
+        } else {
+            return false;
+        }
+    }
+
+    template<typename Member>
+    using is_readable_field = std::bool_constant<is_readable<Member>()>;
+
+    template<typename Member>
+    static constexpr auto display_name = refl::descriptor::get_display_name_const(Member{});
+
+public:
+    struct field {
+        std::string_view name;
+        bool (*holds_type)(const pmtv::pmt &value) noexcept; /// whether 'value' holds the field's type
+        void (*assign)(Node &node, const pmtv::pmt &value);  /// N.B. requires 'holds_type(value)'
+    };
+
+    struct readable_field {
+        std::string_view name;
+        pmtv::pmt (*read)(const Node &node); /// the field's current value
+    };
+
+private:
+    template<typename Member>
+    static constexpr field
+    make_field() noexcept {
+        using Type = field_type<Member>;
+        return { .name       = std::string_view(display_name<Member>.c_str(), display_name<Member>.size),
+                 .holds_type = [](const pmtv::pmt &value) noexcept { return std::holds_alternative<Type>(value); },
+                 .assign     = [](Node &node, const pmtv::pmt &value) { Member{}(node) = std::get<Type>(value); } };
+    }
+
+    static constexpr auto _fields = []<typename... Members>(meta::typelist<Members...>) {
+        std::array<field, sizeof...(Members)> fields{ make_field<Members>()... };
+        std::sort(fields.begin(), fields.end(), [](const field &lhs, const field &rhs) { return lhs.name < rhs.name; });
+        return fields;
+    }(typename meta::to_typelist<refl::descriptor::member_list<Node>>::template filter<is_settable_field>{});
+
+    static constexpr auto _readable_fields = []<typename... Members>(meta::typelist<Members...>) {
+        std::array<readable_field, sizeof...(Members)> fields{ readable_field{ .name = std::string_view(display_name<Members>.c_str(), display_name<Members>.size),
+                                                                               .read = [](const Node &node) { return pmtv::pmt(static_cast<const field_type<Members> &>(Members{}(node))); } }... };
+        std::sort(fields.begin(), fields.end(), [](const readable_field &lhs, const readable_field &rhs) { return lhs.name < rhs.name; });
+        return fields;
+    }(typename meta::to_typelist<refl::descriptor::member_list<Node>>::template filter<is_readable_field>{});
+
+public:
+    [[nodiscard]] static constexpr std::span<const field>
+    fields() noexcept {
+        return _fields;
+    }
+
+    [[nodiscard]] static constexpr std::span<const readable_field>
+    readable_fields() noexcept {
+        return _readable_fields;
+    }
+
+    /**
+     * @return the settable field named 'key' or 'nullptr' if there is none
+     */
+    [[nodiscard]] static constexpr const field *
+    find(std::string_view key) noexcept {
+        const auto it = std::lower_bound(_fields.begin(), _fields.end(), key, [](const field &f, std::string_view k) { return f.name < k; });
+        return it != _fields.end() && it->name == key ? std::addressof(*it) : nullptr;
+    }
+};
+
+} // namespace detail
+
 template<typename Node>
 class basic_settings : public settings_base {
+    /**
+     * @brief settings of one multiplexing context, validated and converted to the field types when set.
+     * N.B. immutable once stored: updates replace the whole set so that the active/pending sets can be switched by pointer
+     */
+    struct context_settings {
+        std::size_t                                                            id = 0;      // stable per context name, also across updates
+        std::vector<std::pair<void (*)(Node &, const pmtv::pmt &), pmtv::pmt>> assignments; // field setters and their values
+        property_map                                                           parameters;  // the same values as key-value pairs
+    };
+    using context_ptr     = std::shared_ptr<const context_settings>;
+    using context_map     = std::map<std::string, context_ptr, std::less<>>;
+    using context_map_ptr = std::shared_ptr<const context_map>;
+
     Node                              *_node = nullptr;
     mutable std::mutex                 _lock{};
     property_map                       _active{}; // copy of class field settings as pmt-style map
     property_map                       _staged{}; // parameters to become active before the next work() call
     std::set<std::string, std::less<>> _auto_update{};
     std::set<std::string, std::less<>> _auto_forward{};
+    context_map_ptr                    _contexts = std::make_shared<const context_map>(); // settings per multiplexing context, replaced as a whole when updated
+    std::atomic<const context_map *>   _contexts_published{ _contexts.get() };            // the current '_contexts', to be checked w/o '_lock'
+    std::vector<context_ptr>           _active_contexts{};                                // contexts switched to since '_active' was refreshed, later ones take precedence
+    // N.B. the following are only accessed by the node's thread, i.e. via 'auto_update(..)' and 'apply_staged_parameters()'
+    context_map_ptr _contexts_snapshot = _contexts; // '_contexts' as seen by the node, renewed only after these changed
+    context_ptr     _pending_context{};             // context switched to, applied by the next 'apply_staged_parameters()'
 
 public:
     basic_settings()  = delete;
@@ -226,31 +371,30 @@ public:
         std::swap(_staged, other._staged);
         std::swap(_auto_update, other._auto_update);
         std::swap(_auto_forward, other._auto_forward);
+        std::swap(_contexts, other._contexts);
+        _contexts_published.store(_contexts.get());
+        other._contexts_published.store(other._contexts.get());
+        std::swap(_active_contexts, other._active_contexts);
+        std::swap(_contexts_snapshot, other._contexts_snapshot);
+        std::swap(_pending_context, other._pending_context);
     }
 
     [[nodiscard]] property_map
-    set(const property_map &parameters, SettingsCtx = {}) override {
+    set(const property_map &parameters, SettingsCtx ctx = {}) override {
         property_map ret;
         if constexpr (refl::is_reflectable<Node>()) {
+            if (const auto context = ctx.context_name(); context.has_value()) {
+                return set_context(*context, parameters);
+            }
             std::lock_guard lg(_lock);
-            for (const auto &[localKey, localValue] : parameters) {
-                const auto &key    = localKey;
-                const auto &value  = localValue;
-                bool        is_set = false;
-                for_each(refl::reflect(*_node).members, [&, this](auto member) {
-                    using Type = unwrap_if_wrapped_t<std::remove_cvref_t<decltype(member(*_node))>>;
-                    if constexpr (is_writable(member) && (std::is_arithmetic_v<Type> || std::is_same_v<Type, std::string> || fair::meta::vector_type<Type>) ) {
-                        if (std::string(get_display_name(member)) == key && std::holds_alternative<Type>(value)) {
-                            if (_auto_update.contains(key)) {
-                                _auto_update.erase(key);
-                            }
-                            _staged.insert_or_assign(key, value);
-                            settings_base::_changed.store(true);
-                            is_set = true;
-                        }
+            for (const auto &[key, value] : parameters) {
+                if (const auto *field = detail::settings_dispatch<Node>::find(key); field != nullptr && field->holds_type(value)) {
+                    if (const auto it = _auto_update.find(key); it != _auto_update.end()) {
+                        _auto_update.erase(it);
                     }
-                });
-                if (!is_set) {
+                    _staged.insert_or_assign(key, value);
+                    settings_base::_changed.store(true);
+                } else {
                     ret.insert_or_assign(key, pmtv::pmt(value));
                 }
             }
@@ -262,18 +406,16 @@ public:
     void
     auto_update(const property_map &parameters, SettingsCtx = {}) override {
         if constexpr (refl::is_reflectable<Node>()) {
-            for (const auto &[localKey, localValue] : parameters) {
-                const auto &key   = localKey;
-                const auto &value = localValue;
-                for_each(refl::reflect(*_node).members, [&](auto member) {
-                    using Type = unwrap_if_wrapped_t<std::remove_cvref_t<decltype(member(*_node))>>;
-                    if constexpr (is_writable(member) && (std::is_arithmetic_v<Type> || std::is_same_v<Type, std::string> || fair::meta::vector_type<Type>) ) {
-                        if (std::string(get_display_name(member)) == key && std::holds_alternative<Type>(value)) {
-                            _staged.insert_or_assign(key, value);
-                            settings_base::_changed.store(true);
-                        }
-                    }
-                });
+            if (const auto it = parameters.find(tag::CONTEXT.key()); it != parameters.end()) {
+                if (const auto *context = std::get_if<std::string>(&it->second)) {
+                    switch_context(*context);
+                }
+            }
+            for (const auto &[key, value] : parameters) {
+                if (const auto *field = detail::settings_dispatch<Node>::find(key); field != nullptr && field->holds_type(value)) {
+                    _staged.insert_or_assign(key, value);
+                    settings_base::_changed.store(true);
+                }
             }
         }
     }
@@ -285,28 +427,26 @@ public:
     }
 
     [[nodiscard]] property_map
-    get(std::span<const std::string> parameter_keys = {}, SettingsCtx = {}) const noexcept override {
+    get(std::span<const std::string> parameter_keys = {}, SettingsCtx ctx = {}) const noexcept override {
         std::lock_guard lg(_lock);
-        property_map    ret;
         if (parameter_keys.empty()) {
-            ret = _active;
-            return ret;
+            return parameters_for(ctx);
         }
+        property_map ret;
         for (const auto &key : parameter_keys) {
-            if (_active.contains(key)) {
-                ret.insert_or_assign(key, _active.at(key));
+            if (const auto *value = find_parameter(ctx, key); value != nullptr) {
+                ret.insert_or_assign(key, *value);
             }
         }
         return ret;
     }
 
     [[nodiscard]] std::optional<pmtv::pmt>
-    get(const std::string &parameter_key, SettingsCtx = {}) const noexcept override {
+    get(const std::string &parameter_key, SettingsCtx ctx = {}) const noexcept override {
         if constexpr (refl::is_reflectable<Node>()) {
             std::lock_guard lg(_lock);
-
-            if (_active.contains(parameter_key)) {
-                return { _active.at(parameter_key) };
+            if (const auto *value = find_parameter(ctx, parameter_key); value != nullptr) {
+                return { *value };
             }
         }
 
@@ -336,44 +476,45 @@ public:
 
             property_map    oldSettings;
             if constexpr (requires(Node d, const property_map &map) { d.init(map, map); }) {
-                // take a copy of the field -> map value of the old settings
-                if constexpr (refl::is_reflectable<Node>()) {
-                    for_each(refl::reflect(*_node).members, [&, this](auto member) {
-                        using Type = unwrap_if_wrapped_t<std::remove_cvref_t<decltype(member(*_node))>>;
-
-                        if constexpr (is_readable(member) && (std::integral<Type> || std::floating_point<Type> || std::is_same_v<Type, std::string> || fair::meta::vector_type<Type>) ) {
-                            oldSettings.insert_or_assign(get_display_name(member), pmtv::pmt(member(*_node)));
-                        }
-                    });
-                }
+                read_fields(oldSettings); // take a copy of the field -> map value of the old settings
             }
 
             property_map staged;
-            for (const auto &[localKey, localStaged_value] : _staged) {
-                const auto &key          = localKey;
-                const auto &staged_value = localStaged_value;
-                for_each(refl::reflect(*_node).members, [&key, &staged, &forward_parameters, &staged_value, this](auto member) {
-                    using Type = unwrap_if_wrapped_t<std::remove_cvref_t<decltype(member(*_node))>>;
-                    if constexpr (is_writable(member) && (std::integral<Type> || std::floating_point<Type> || std::is_same_v<Type, std::string> || fair::meta::vector_type<Type>) ) {
-                        if (std::string(get_display_name(member)) == key && std::holds_alternative<Type>(staged_value)) {
-                            member(*_node) = std::get<Type>(staged_value);
-                            if constexpr (requires { _node->init(/* old settings */ _active, /* new settings */ staged); }) {
-                                staged.insert_or_assign(key, staged_value);
-                            }
-                            if (_auto_forward.contains(get_display_name(member))) {
-                                forward_parameters.insert_or_assign(key, staged_value);
-                            }
-                        }
+            if (_pending_context) {
+                // context switch: the values are already validated and converted, explicitly staged ones (e.g. from the same tag) take precedence
+                for (const auto &[assign, value] : _pending_context->assignments) {
+                    assign(*_node, value);
+                }
+                if constexpr (requires { _node->init(/* old settings */ _active, /* new settings */ staged); }) {
+                    staged = _pending_context->parameters;
+                }
+                for (const auto &key : _auto_forward) {
+                    if (const auto *value = find(_pending_context->parameters, key); value != nullptr) {
+                        forward_parameters.insert_or_assign(key, *value);
                     }
-                });
+                }
+                if (_staged.empty() && !_active.empty()) {
+                    // pure switch: rather than refreshing '_active', the context's (immutable) settings take precedence over it, see 'find_parameter(..)'
+                    // N.B. at most one entry per context, the capacity is reserved by 'set_context(..)'
+                    std::erase_if(_active_contexts, [id = _pending_context->id](const context_ptr &context) { return context->id == id; });
+                    _active_contexts.push_back(std::move(_pending_context));
+                }
+                _pending_context.reset();
             }
-            for_each(refl::reflect(*_node).members, [&, this](auto member) {
-                using Type = unwrap_if_wrapped_t<std::remove_cvref_t<decltype(member(*_node))>>;
-
-                if constexpr (is_readable(member) && (std::integral<Type> || std::floating_point<Type> || std::is_same_v<Type, std::string> || fair::meta::vector_type<Type>) ) {
-                    _active.insert_or_assign(get_display_name(member), pmtv::pmt(member(*_node)));
+            for (const auto &[key, staged_value] : _staged) {
+                if (const auto *field = detail::settings_dispatch<Node>::find(key); field != nullptr && field->holds_type(staged_value)) {
+                    field->assign(*_node, staged_value);
+                    if constexpr (requires { _node->init(/* old settings */ _active, /* new settings */ staged); }) {
+                        staged.insert_or_assign(key, staged_value);
+                    }
+                    if (_auto_forward.contains(key)) {
+                        forward_parameters.insert_or_assign(key, staged_value);
+                    }
                 }
-            });
+            }
+            if (!_staged.empty() || _active.empty()) {
+                refresh_active(); // N.B. also picks up fields modified by the node itself
+            }
             if constexpr (requires(Node d, const property_map &map) { d.init(map, map); }) {
                 if (!staged.empty()) {
                     _node->init(/* old settings */ oldSettings, /* new settings */ staged);
@@ -388,13 +529,130 @@ public:
     update_active_parameters() noexcept override {
         if constexpr (refl::is_reflectable<Node>()) {
             std::lock_guard lg(_lock);
-            for_each(refl::reflect(*_node).members, [&, this](auto member) {
-                using Type = unwrap_if_wrapped_t<std::remove_cvref_t<decltype(member(*_node))>>;
+            refresh_active();
+        }
+    }
 
-                if constexpr (is_readable(member) && (std::integral<Type> || std::floating_point<Type> || std::is_same_v<Type, std::string>) ) {
-                    _active.insert_or_assign(get_display_name_const(member).str(), member(*_node));
-                }
-            });
+private:
+    /**
+     * @brief copies the node's readable fields into 'settings' via the dispatch table, keys that are already present keep their
+     * map node, i.e. only their values are assigned (N.B. requires '_lock' being held)
+     */
+    void
+    read_fields(property_map &settings) const {
+        auto it = settings.begin();
+        for (const auto &field : detail::settings_dispatch<Node>::readable_fields()) { // N.B. sorted by name like 'settings'
+            while (it != settings.end() && it->first < field.name) {
+                ++it;
+            }
+            if (it != settings.end() && it->first == field.name) {
+                it->second = field.read(*_node);
+                ++it;
+            } else {
+                it = std::next(settings.emplace_hint(it, field.name, field.read(*_node)));
+            }
+        }
+    }
+
+    /**
+     * @brief re-reads '_active' from the node's fields, which supersedes the contexts switched to before (N.B. requires '_lock' being held)
+     */
+    void
+    refresh_active() {
+        read_fields(_active);
+        _active_contexts.clear();
+    }
+
+    [[nodiscard]] static const pmtv::pmt *
+    find(const property_map &map, std::string_view key) {
+        const auto it = map.find(key);
+        return it != map.end() ? std::addressof(it->second) : nullptr;
+    }
+
+    /**
+     * @brief N.B. requires '_lock' being held
+     * @return the active value or the one stored for the multiplexing context named in 'ctx', 'nullptr' if there is none
+     */
+    [[nodiscard]] const pmtv::pmt *
+    find_parameter(const SettingsCtx &ctx, std::string_view key) const {
+        if (const auto context = ctx.context_name(); context.has_value()) {
+            const auto it = _contexts->find(*context);
+            return it != _contexts->end() ? find(it->second->parameters, key) : nullptr;
+        }
+        for (auto it = _active_contexts.rbegin(); it != _active_contexts.rend(); ++it) {
+            if (const auto *value = find((*it)->parameters, key); value != nullptr) {
+                return value;
+            }
+        }
+        return find(_active, key);
+    }
+
+    /**
+     * @brief N.B. requires '_lock' being held
+     * @return the active settings or those stored for the multiplexing context named in 'ctx' (empty if unknown)
+     */
+    [[nodiscard]] property_map
+    parameters_for(const SettingsCtx &ctx) const {
+        if (const auto context = ctx.context_name(); context.has_value()) {
+            const auto it = _contexts->find(*context);
+            return it != _contexts->end() ? it->second->parameters : property_map{};
+        }
+        property_map ret = _active;
+        for (const auto &active_context : _active_contexts) {
+            for (const auto &[key, value] : active_context->parameters) {
+                ret.insert_or_assign(key, value);
+            }
+        }
+        return ret;
+    }
+
+    /**
+     * @brief validates and stores 'parameters' for the given multiplexing context, merged with those stored before
+     * N.B. copy-on-write: the context map is replaced as a whole so that 'switch_context(..)' can look up contexts without '_lock'
+     * @return key-value pairs that could not be set
+     */
+    [[nodiscard]] property_map
+    set_context(std::string_view context, const property_map &parameters) {
+        property_map    ret;
+        std::lock_guard lg(_lock);
+        auto            contexts = std::make_shared<context_map>(*_contexts);
+        auto            settings = std::make_shared<context_settings>();
+        settings->id             = contexts->size();
+        if (const auto it = contexts->find(context); it != contexts->end()) {
+            settings->id         = it->second->id;
+            settings->parameters = it->second->parameters;
+        }
+        for (const auto &[key, value] : parameters) {
+            if (const auto *field = detail::settings_dispatch<Node>::find(key); field != nullptr && field->holds_type(value)) {
+                settings->parameters.insert_or_assign(key, value);
+            } else {
+                ret.insert_or_assign(key, value);
+            }
+        }
+        settings->assignments.reserve(settings->parameters.size());
+        for (const auto &[key, value] : settings->parameters) {
+            settings->assignments.emplace_back(detail::settings_dispatch<Node>::find(key)->assign, value);
+        }
+        contexts->insert_or_assign(std::string(context), std::move(settings)); // N.B. a pending switch keeps the previous (immutable) set alive
+        _contexts = std::move(contexts);
+        _contexts_published.store(_contexts.get(), std::memory_order_release);
+        _active_contexts.reserve(_contexts->size()); // N.B. keeps 'apply_staged_parameters()' free of allocations on context switches
+        return ret;
+    }
+
+    /**
+     * @brief switches to the settings stored for 'context' by reference, i.e. without copying or re-validating them
+     * N.B. takes '_lock' only to renew the node's snapshot of the contexts after these were changed by 'set_context(..)'
+     */
+    void
+    switch_context(std::string_view context) {
+        if (_contexts_published.load(std::memory_order_acquire) != _contexts_snapshot.get()) {
+            std::lock_guard lg(_lock);
+            _contexts_snapshot = _contexts;
+        }
+        if (const auto it = _contexts_snapshot->find(context); it != _contexts_snapshot->end()) {
+            _pending_context = it->second;
+            settings_base::_changed.store(true);
         }
     }
 };
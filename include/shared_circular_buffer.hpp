@@ -0,0 +1,504 @@
+#ifndef GNURADIO_SHARED_CIRCULAR_BUFFER_HPP
+#define GNURADIO_SHARED_CIRCULAR_BUFFER_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "buffer.hpp"
+#include "sequence.hpp"
+#include "wait_strategy.hpp"
+
+#if defined __has_include && not __EMSCRIPTEN__
+#if __has_include(<sys/mman.h>) && __has_include(<sys/socket.h>) && __has_include(<sys/stat.h>) && __has_include(<unistd.h>)
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define HAS_SHARED_MEMORY_INTERFACE
+#endif
+#endif
+
+namespace gr {
+
+#ifdef HAS_SHARED_MEMORY_INTERFACE
+namespace shm {
+
+/**
+ * @brief control block placed at the start of the shared memfd, followed by the (double-mapped) sample data.
+ *
+ * All members are address-free lock-free atomics so that the block can be mapped at different addresses in
+ * different processes. Unused reader slots hold 'kUnused' and are ignored by the writer's gating-sequence scan.
+ */
+struct shared_buffer_header {
+    static constexpr std::uint64_t kMagic      = 0x4752'5348'4D42'5546ULL; // "GRSHMBUF"
+    static constexpr std::uint32_t kVersion    = 1;
+    static constexpr std::size_t   kMaxReaders = 32;
+    static constexpr Sequence::signed_index_type kUnused = std::numeric_limits<Sequence::signed_index_type>::max();
+    static_assert(std::atomic<std::int64_t>::is_always_lock_free && std::atomic<std::uint64_t>::is_always_lock_free, "shared atomics must be lock-free");
+
+    std::uint64_t                       magic        = kMagic;
+    std::uint32_t                       version      = kVersion;
+    std::uint32_t                       element_size = 0;
+    std::uint64_t                       size         = 0; // number of elements, power of two
+    std::uint64_t                       data_offset  = 0; // [bytes] offset of the sample data within the memfd
+    std::atomic<std::uint32_t>          writer_attached{ 0 };
+    std::atomic<std::uint32_t>          closed{ 0 }; // set once the writer detached, i.e. end-of-stream after the remaining samples
+    std::atomic<std::uint64_t>          occupied{ 0 }; // reader slot mask
+    Sequence                            cursor;
+    std::array<Sequence, kMaxReaders>   read_indices;
+
+    shared_buffer_header(std::size_t elementSize, std::size_t nElements, std::size_t dataOffset) noexcept
+        : element_size(static_cast<std::uint32_t>(elementSize)), size(nElements), data_offset(dataOffset) {
+        for (auto &index : read_indices) {
+            index.setValue(kUnused);
+        }
+    }
+
+    [[nodiscard]] Sequence::signed_index_type getMinimumSequence(Sequence::signed_index_type minimum) const noexcept {
+        for (std::uint64_t mask = occupied.load(std::memory_order_acquire); mask != 0; mask &= mask - 1) {
+            minimum = std::min(minimum, read_indices[static_cast<std::size_t>(std::countr_zero(mask))].value());
+        }
+        return minimum;
+    }
+};
+
+/**
+ * @brief passes a file descriptor to another process via a connected Unix domain socket (SCM_RIGHTS)
+ */
+inline void
+send_fd(int socket, int fd) {
+    char   dummy = 'F';
+    iovec  io{ .iov_base = &dummy, .iov_len = 1 };
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))]{};
+    msghdr message{};
+    message.msg_iov        = &io;
+    message.msg_iovlen     = 1;
+    message.msg_control    = control;
+    message.msg_controllen = sizeof(control);
+
+    cmsghdr *cmsg          = CMSG_FIRSTHDR(&message);
+    cmsg->cmsg_level       = SOL_SOCKET;
+    cmsg->cmsg_type        = SCM_RIGHTS;
+    cmsg->cmsg_len         = CMSG_LEN(sizeof(int));
+    std::memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
+
+    if (::sendmsg(socket, &message, 0) < 0) {
+        throw std::runtime_error(fmt::format("shm::send_fd(socket: {}, fd: {}) - sendmsg failed: {}", socket, fd, strerror(errno)));
+    }
+}
+
+/**
+ * @brief receives a file descriptor sent by 'send_fd(..)', the caller owns the returned descriptor
+ */
+[[nodiscard]] inline int
+receive_fd(int socket) {
+    char   dummy = 0;
+    iovec  io{ .iov_base = &dummy, .iov_len = 1 };
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))]{};
+    msghdr message{};
+    message.msg_iov        = &io;
+    message.msg_iovlen     = 1;
+    message.msg_control    = control;
+    message.msg_controllen = sizeof(control);
+
+    if (::recvmsg(socket, &message, MSG_CMSG_CLOEXEC) <= 0) {
+        throw std::runtime_error(fmt::format("shm::receive_fd(socket: {}) - recvmsg failed: {}", socket, strerror(errno)));
+    }
+    const cmsghdr *cmsg = CMSG_FIRSTHDR(&message);
+    if (cmsg == nullptr || cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS || cmsg->cmsg_len != CMSG_LEN(sizeof(int))) {
+        throw std::runtime_error(fmt::format("shm::receive_fd(socket: {}) - message did not contain a file descriptor", socket));
+    }
+    int fd = -1;
+    std::memcpy(&fd, CMSG_DATA(cmsg), sizeof(int));
+    return fd;
+}
+
+} // namespace shm
+
+/**
+ * @brief single-producer multi-consumer circular buffer whose sample data, write cursor and reader indices live in a
+ * (named) memfd that can be shared with other processes.
+ *
+ * The creating process owns the memfd. Its descriptor ('native_handle()') can be passed to another process via a Unix
+ * domain socket ('shm::send_fd(..)'/'shm::receive_fd(..)') which then 'attach(..)'es to the same buffer. The sample data
+ * is double-mapped in each process (see double_mapped_memory_resource) and the reader/writer semantics are identical
+ * to the single-process circular_buffer: zero-copy, lock-free, and at most one writer across all processes.
+ *
+ * N.B. waiting is limited to spinning since futexes used by std::atomic::wait are process-private. A crashed reader
+ * process keeps its slot and thus gates the writer. Hence, use a dedicated buffer per process-pair.
+ *
+ * @tparam T trivially-copyable sample type (no pointers into process-private memory)
+ */
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+class shared_circular_buffer {
+    using signed_index_type = Sequence::signed_index_type;
+    using header_type       = shm::shared_buffer_header;
+
+    struct mapping {
+        int          _fd           = -1;
+        std::byte   *_base         = nullptr;
+        std::size_t  _mapped_bytes = 0;
+        header_type *_header       = nullptr;
+        T           *_data         = nullptr;
+        std::size_t  _size         = 0;
+
+        mapping(int fd, std::size_t header_bytes, std::size_t data_bytes) : _fd(fd), _mapped_bytes(header_bytes + 2 * data_bytes) {
+            // reserve a contiguous address range first, then map the header and twice the data region into it
+            void *reserved = ::mmap(nullptr, _mapped_bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (reserved == MAP_FAILED) {
+                const int error = errno;
+                ::close(_fd);
+                throw std::runtime_error(fmt::format("shared_circular_buffer - could not reserve {} bytes: {}", _mapped_bytes, strerror(error)));
+            }
+            _base = static_cast<std::byte *>(reserved);
+            if (::mmap(_base, header_bytes, PROT_READ | PROT_WRITE, MAP_FIXED | MAP_SHARED, _fd, 0) == MAP_FAILED                                                               //
+                    || ::mmap(_base + header_bytes, data_bytes, PROT_READ | PROT_WRITE, MAP_FIXED | MAP_SHARED, _fd, static_cast<off_t>(header_bytes)) == MAP_FAILED                 //
+                    || ::mmap(_base + header_bytes + data_bytes, data_bytes, PROT_READ | PROT_WRITE, MAP_FIXED | MAP_SHARED, _fd, static_cast<off_t>(header_bytes)) == MAP_FAILED) { //
+                const int error = errno;
+                ::munmap(_base, _mapped_bytes);
+                ::close(_fd);
+                throw std::runtime_error(fmt::format("shared_circular_buffer - could not map memfd {}: {}", _fd, strerror(error)));
+            }
+            _header = reinterpret_cast<header_type *>(_base);
+            _data   = reinterpret_cast<T *>(_base + header_bytes);
+        }
+
+        mapping(const mapping &)            = delete;
+        mapping &operator=(const mapping &) = delete;
+
+        ~mapping() {
+            ::munmap(_base, _mapped_bytes);
+            ::close(_fd);
+        }
+    };
+
+    static std::size_t header_bytes() noexcept { return util_round_up(sizeof(header_type), static_cast<std::size_t>(getpagesize())); }
+
+    static constexpr std::size_t util_round_up(std::size_t value, std::size_t multiple) noexcept { return (value + multiple - 1) / multiple * multiple; }
+
+    std::shared_ptr<mapping> _mapping;
+
+    explicit shared_circular_buffer(std::shared_ptr<mapping> mapping_ptr) noexcept : _mapping(std::move(mapping_ptr)) {}
+
+    template<typename U = T>
+    class buffer_writer;
+    template<typename U = T>
+    class buffer_reader;
+
+public:
+    using value_type = T;
+
+    shared_circular_buffer() = delete;
+
+    /**
+     * creates a new shared buffer with at least 'min_size' samples (rounded up to a power-of-two and page size)
+     * @param name memfd name (for debugging, e.g. visible in /proc/<pid>/fd)
+     */
+    explicit shared_circular_buffer(std::size_t min_size, std::string_view name = "gr_shared_buffer") {
+        const auto pageSize = static_cast<std::size_t>(getpagesize());
+        std::size_t size    = std::bit_ceil(std::max(min_size, std::size_t{ 1 }));
+        while ((size * sizeof(T)) % pageSize != 0) {
+            size *= 2;
+        }
+        const std::size_t dataBytes = size * sizeof(T);
+
+        const int fd = ::memfd_create(std::string(name).c_str(), MFD_CLOEXEC);
+        if (fd < 0) {
+            throw std::runtime_error(fmt::format("shared_circular_buffer - memfd_create({}) failed: {}", name, strerror(errno)));
+        }
+        if (::ftruncate(fd, static_cast<off_t>(header_bytes() + dataBytes)) != 0) {
+            const int error = errno;
+            ::close(fd);
+            throw std::runtime_error(fmt::format("shared_circular_buffer - ftruncate({}) failed: {}", header_bytes() + dataBytes, strerror(error)));
+        }
+        _mapping = std::make_shared<mapping>(fd, header_bytes(), dataBytes);
+        std::construct_at(_mapping->_header, sizeof(T), size, header_bytes());
+        _mapping->_size = size;
+    }
+
+    /**
+     * attaches to a shared buffer created by another process, takes ownership of 'fd' (e.g. obtained by 'shm::receive_fd(..)')
+     */
+    [[nodiscard]] static shared_circular_buffer attach(int fd) {
+        struct stat status {};
+        if (::fstat(fd, &status) != 0 || static_cast<std::size_t>(status.st_size) < header_bytes()) {
+            ::close(fd);
+            throw std::runtime_error(fmt::format("shared_circular_buffer::attach({}) - not a shared buffer memfd", fd));
+        }
+        const std::size_t dataBytes = static_cast<std::size_t>(status.st_size) - header_bytes();
+        auto              map       = std::make_shared<mapping>(fd, header_bytes(), dataBytes);
+        const auto       &header    = *map->_header;
+        if (header.magic != header_type::kMagic || header.version != header_type::kVersion || header.element_size != sizeof(T) || header.size * sizeof(T) != dataBytes
+            || header.data_offset != header_bytes()) {
+            throw std::runtime_error(fmt::format("shared_circular_buffer::attach({}) - incompatible header (version: {}, element size: {} vs. {})", fd, header.version, header.element_size, sizeof(T)));
+        }
+        map->_size = header.size;
+        return shared_circular_buffer(std::move(map));
+    }
+
+    [[nodiscard]] std::size_t       size() const noexcept { return _mapping->_size; }
+    [[nodiscard]] BufferWriter auto new_writer() { return buffer_writer<T>(_mapping); }
+    [[nodiscard]] BufferReader auto new_reader() { return buffer_reader<T>(_mapping); }
+
+    // implementation specific interface -- not part of public Buffer / production-code API
+    [[nodiscard]] int               native_handle() const noexcept { return _mapping->_fd; } // memfd to be passed to other processes
+    [[nodiscard]] std::size_t       n_readers() const noexcept { return static_cast<std::size_t>(std::popcount(_mapping->_header->occupied.load(std::memory_order_acquire))); }
+    [[nodiscard]] bool              is_closed() const noexcept { return _mapping->_header->closed.load(std::memory_order_acquire) != 0; }
+    [[nodiscard]] const Sequence   &cursor_sequence() const noexcept { return _mapping->_header->cursor; }
+};
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+template<typename U>
+class shared_circular_buffer<T>::buffer_writer {
+    std::shared_ptr<mapping> _mapping; // controls the mapping's life-cycle, the rest are cache optimisations
+    header_type             *_header;
+    T                       *_data;
+    std::size_t              _size;
+    signed_index_type        _cachedGatingSequence = kInitialCursorValue;
+
+    [[nodiscard]] std::size_t index_of(signed_index_type sequence) const noexcept { return static_cast<std::size_t>(sequence) & (_size - 1); }
+
+    [[nodiscard]] bool has_capacity(std::size_t n_slots) noexcept {
+        const signed_index_type cursor    = _header->cursor.value();
+        const signed_index_type wrapPoint = cursor + static_cast<signed_index_type>(n_slots) - static_cast<signed_index_type>(_size);
+        if (wrapPoint > _cachedGatingSequence || _cachedGatingSequence > cursor) {
+            _cachedGatingSequence = _header->getMinimumSequence(cursor);
+        }
+        return wrapPoint <= _cachedGatingSequence;
+    }
+
+    template<typename Translator, typename... Args>
+    void translate_and_publish(Translator &&translator, std::size_t n_slots, Args &&...args) {
+        const signed_index_type writePosition = _header->cursor.value();
+        std::span<U>            writable_data(&_data[index_of(writePosition + 1)], n_slots); // N.B. contiguous thanks to the double-mapping
+        if constexpr (std::is_invocable_v<Translator, std::span<T> &, signed_index_type, Args...>) {
+            std::invoke(translator, writable_data, writePosition, std::forward<Args>(args)...);
+        } else {
+            std::invoke(translator, writable_data, std::forward<Args>(args)...);
+        }
+        _header->cursor.setValue(writePosition + static_cast<signed_index_type>(n_slots));
+    }
+
+public:
+    class ReservedOutputRange : public std::span<T> {
+        buffer_writer *_parent = nullptr;
+
+    public:
+        ReservedOutputRange() noexcept = default;
+        ReservedOutputRange(buffer_writer *parent, std::span<T> range) noexcept : std::span<T>(range), _parent(parent) {}
+        ReservedOutputRange(const ReservedOutputRange &)            = delete;
+        ReservedOutputRange &operator=(const ReservedOutputRange &) = delete;
+        ReservedOutputRange(ReservedOutputRange &&other) noexcept : std::span<T>(other), _parent(std::exchange(other._parent, nullptr)) {}
+        ReservedOutputRange &operator=(ReservedOutputRange &&other) noexcept {
+            std::span<T>::operator=(other);
+            _parent = std::exchange(other._parent, nullptr);
+            return *this;
+        }
+        ~ReservedOutputRange() {
+            if (_parent != nullptr && !this->empty()) {
+                fmt::print(stderr, "shared_circular_buffer::ReservedOutputRange() - omitted publish call for {} reserved samples", this->size());
+                std::terminate();
+            }
+        }
+
+        void publish(std::size_t n_produced) noexcept {
+            assert(n_produced <= this->size() && "n_produced must be <= than claimed slots");
+            if (_parent != nullptr) {
+                _parent->_header->cursor.setValue(_parent->_header->cursor.value() + static_cast<signed_index_type>(n_produced));
+                _parent = nullptr;
+            }
+        }
+    };
+
+    buffer_writer() = delete;
+    explicit buffer_writer(std::shared_ptr<mapping> mapping_ptr) : _mapping(std::move(mapping_ptr)), _header(_mapping->_header), _data(_mapping->_data), _size(_mapping->_size) {
+        std::uint32_t expected = 0;
+        if (!_header->writer_attached.compare_exchange_strong(expected, 1, std::memory_order_acq_rel)) {
+            throw std::runtime_error("shared_circular_buffer::buffer_writer() - buffer has already a writer attached (possibly in another process)");
+        }
+        _header->closed.store(0, std::memory_order_release);
+    }
+    buffer_writer(const buffer_writer &) = delete;
+    buffer_writer(buffer_writer &&other) noexcept
+        : _mapping(std::move(other._mapping)), _header(std::exchange(other._header, nullptr)), _data(other._data), _size(other._size), _cachedGatingSequence(other._cachedGatingSequence) {}
+    buffer_writer &operator=(buffer_writer tmp) noexcept {
+        std::swap(_mapping, tmp._mapping);
+        std::swap(_header, tmp._header);
+        std::swap(_data, tmp._data);
+        std::swap(_size, tmp._size);
+        std::swap(_cachedGatingSequence, tmp._cachedGatingSequence);
+        return *this;
+    }
+    ~buffer_writer() {
+        if (_header != nullptr) {
+            _header->closed.store(1, std::memory_order_release);
+            _header->writer_attached.store(0, std::memory_order_release);
+        }
+    }
+
+    [[nodiscard]] shared_circular_buffer buffer() const noexcept { return shared_circular_buffer(_mapping); }
+
+    [[nodiscard]] ReservedOutputRange    reserve_output_range(std::size_t n_slots_to_claim) noexcept {
+        SpinWait spinWait;
+        while (!has_capacity(n_slots_to_claim)) {
+            spinWait.spinOnce();
+        }
+        return ReservedOutputRange(this, { &_data[index_of(_header->cursor.value() + 1)], n_slots_to_claim });
+    }
+
+    [[nodiscard]] ReservedOutputRange try_reserve_output_range(std::size_t n_slots_to_claim) noexcept {
+        if (!has_capacity(n_slots_to_claim)) {
+            return ReservedOutputRange();
+        }
+        return ReservedOutputRange(this, { &_data[index_of(_header->cursor.value() + 1)], n_slots_to_claim });
+    }
+
+    template<typename... Args, WriterCallback<U, Args...> Translator>
+    void publish(Translator &&translator, std::size_t n_slots_to_claim = 1, Args &&...args) {
+        if (n_slots_to_claim == 0 || _header->occupied.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+        SpinWait spinWait; // N.B. futexes are process-private -> spin
+        while (!has_capacity(n_slots_to_claim)) {
+            spinWait.spinOnce();
+        }
+        translate_and_publish(std::forward<Translator>(translator), n_slots_to_claim, std::forward<Args>(args)...);
+    } // blocks until elements are available
+
+    template<typename... Args, WriterCallback<U, Args...> Translator>
+    bool try_publish(Translator &&translator, std::size_t n_slots_to_claim = 1, Args &&...args) {
+        if (n_slots_to_claim == 0 || _header->occupied.load(std::memory_order_acquire) == 0) {
+            return true;
+        }
+        if (!has_capacity(n_slots_to_claim)) {
+            return false;
+        }
+        translate_and_publish(std::forward<Translator>(translator), n_slots_to_claim, std::forward<Args>(args)...);
+        return true;
+    }
+
+    [[nodiscard]] signed_index_type position() const noexcept { return _header->cursor.value(); }
+
+    [[nodiscard]] std::size_t       available() const noexcept {
+        const signed_index_type cursor = _header->cursor.value();
+        return _size - static_cast<std::size_t>(cursor - _header->getMinimumSequence(cursor));
+    }
+
+    /**
+     * marks the end of the stream for readers in other processes (also done by the destructor)
+     */
+    void close() noexcept { _header->closed.store(1, std::memory_order_release); }
+};
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+template<typename U>
+class shared_circular_buffer<T>::buffer_reader {
+    std::shared_ptr<mapping> _mapping; // controls the mapping's life-cycle, the rest are cache optimisations
+    header_type             *_header;
+    const T                 *_data;
+    std::size_t              _size;
+    std::size_t              _slot = header_type::kMaxReaders;
+    signed_index_type        _read_index_cached;
+
+    [[nodiscard]] std::size_t buffer_index() const noexcept { return static_cast<std::size_t>(_read_index_cached + 1) & (_size - 1); }
+
+public:
+    buffer_reader() = delete;
+    explicit buffer_reader(std::shared_ptr<mapping> mapping_ptr) : _mapping(std::move(mapping_ptr)), _header(_mapping->_header), _data(_mapping->_data), _size(_mapping->_size) {
+        std::uint64_t mask = _header->occupied.load(std::memory_order_acquire);
+        do {
+            if (mask == ~std::uint64_t{ 0 } >> (64 - header_type::kMaxReaders)) {
+                throw std::runtime_error(fmt::format("shared_circular_buffer::buffer_reader() - exceeded the maximum number of {} readers", header_type::kMaxReaders));
+            }
+            _slot = static_cast<std::size_t>(std::countr_one(mask));
+        } while (!_header->occupied.compare_exchange_weak(mask, mask | (std::uint64_t{ 1 } << _slot), std::memory_order_acq_rel));
+        // N.B. set twice: the writer may have advanced between reading the cursor and the slot becoming visible
+        _header->read_indices[_slot].setValue(_header->cursor.value());
+        _header->read_indices[_slot].setValue(_header->cursor.value());
+        _read_index_cached = _header->read_indices[_slot].value();
+    }
+    buffer_reader(const buffer_reader &) = delete;
+    buffer_reader(buffer_reader &&other) noexcept
+        : _mapping(std::move(other._mapping))
+        , _header(std::exchange(other._header, nullptr))
+        , _data(other._data)
+        , _size(other._size)
+        , _slot(std::exchange(other._slot, header_type::kMaxReaders))
+        , _read_index_cached(other._read_index_cached) {}
+    buffer_reader &operator=(buffer_reader tmp) noexcept {
+        std::swap(_mapping, tmp._mapping);
+        std::swap(_header, tmp._header);
+        std::swap(_data, tmp._data);
+        std::swap(_size, tmp._size);
+        std::swap(_slot, tmp._slot);
+        std::swap(_read_index_cached, tmp._read_index_cached);
+        return *this;
+    }
+    ~buffer_reader() {
+        if (_header != nullptr && _slot < header_type::kMaxReaders) {
+            _header->read_indices[_slot].setValue(header_type::kUnused);
+            _header->occupied.fetch_and(~(std::uint64_t{ 1 } << _slot), std::memory_order_acq_rel);
+        }
+    }
+
+    [[nodiscard]] shared_circular_buffer buffer() const noexcept { return shared_circular_buffer(_mapping); }
+
+    template<bool strict_check = true>
+    [[nodiscard]] std::span<const U> get(const std::size_t n_requested = 0) const noexcept {
+        if constexpr (strict_check) {
+            return { &_data[buffer_index()], n_requested > 0 ? std::min(n_requested, available()) : available() };
+        }
+        return { &_data[buffer_index()], n_requested > 0 ? n_requested : available() };
+    }
+
+    template<bool strict_check = true>
+    [[nodiscard]] bool consume(const std::size_t n_elements = 1) noexcept {
+        if constexpr (strict_check) {
+            if (n_elements == 0) {
+                return true;
+            }
+            if (n_elements > available()) {
+                return false;
+            }
+        }
+        _read_index_cached += static_cast<signed_index_type>(n_elements);
+        _header->read_indices[_slot].setValue(_read_index_cached);
+        return true;
+    }
+
+    [[nodiscard]] signed_index_type position() const noexcept { return _read_index_cached; }
+
+    [[nodiscard]] std::size_t       available() const noexcept { return static_cast<std::size_t>(_header->cursor.value() - _read_index_cached); }
+
+    /**
+     * @return true if the writer detached and all samples have been consumed
+     */
+    [[nodiscard]] bool end_of_stream() const noexcept { return _header->closed.load(std::memory_order_acquire) != 0 && available() == 0; }
+};
+
+static_assert(Buffer<shared_circular_buffer<int32_t>>);
+#endif // HAS_SHARED_MEMORY_INTERFACE
+
+} // namespace gr
+
+#endif // GNURADIO_SHARED_CIRCULAR_BUFFER_HPP
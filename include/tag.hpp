@@ -2,6 +2,8 @@
 #define GRAPH_PROTOTYPE_TAG_HPP
 
 #include <map>
+#include <memory>
+#include <memory_resource>
 #include <pmtv/pmt.hpp>
 #include <reflection.hpp>
 #include <utils.hpp>
@@ -98,6 +100,87 @@ struct alignas(hardware_constructive_interference_size) tag_t {
         map[key] = value;
     }
 };
+
+namespace detail {
+/**
+ * @brief pool shared by all compact tag payloads -- intentionally never destroyed since payloads may outlive static objects
+ */
+inline std::pmr::memory_resource *
+tag_payload_resource() noexcept {
+    static auto *instance = new std::pmr::synchronized_pool_resource();
+    return instance;
+}
+} // namespace detail
+
+/**
+ * @brief compact alternative to 'tag_t' for tag buffers, e.g. 'port<..., gr::circular_buffer<compact_tag_t>>':
+ * the buffer slot only holds the sample index and a reference-counted handle to an immutable payload that is allocated
+ * from a shared pool (see 'make_tag_payload(...)'). Readers of the same tag buffer share the payload rather than copying it.
+ */
+struct compact_tag_t {
+    using payload_type                    = std::shared_ptr<const property_map>;
+
+    std::make_signed_t<std::size_t> index = 0;
+    payload_type                    payload;
+
+    [[nodiscard]] const property_map &
+    map() const noexcept {
+        static const property_map empty{};
+        return payload ? *payload : empty;
+    }
+
+    [[nodiscard]] const pmtv::pmt &
+    at(const std::string &key) const {
+        return map().at(key);
+    }
+
+    [[nodiscard]] std::optional<std::reference_wrapper<const pmtv::pmt>>
+    get(const std::string &key) const noexcept {
+        const auto &m = map();
+        if (const auto it = m.find(key); it != m.end()) {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+};
+
+[[nodiscard]] inline compact_tag_t::payload_type
+make_tag_payload(property_map &&map) {
+    return std::allocate_shared<property_map>(std::pmr::polymorphic_allocator<property_map>(detail::tag_payload_resource()), std::move(map));
+}
+
+/**
+ * @brief uniform access to the key-value payload of 'tag_t' and 'compact_tag_t' for code that is generic w.r.t. the port's tag buffer type
+ */
+[[nodiscard]] inline const property_map &
+tag_map(const tag_t &tag) noexcept {
+    return tag.map;
+}
+
+[[nodiscard]] inline const property_map &
+tag_map(const compact_tag_t &tag) noexcept {
+    return tag.map();
+}
+
+inline void
+set_tag_map(tag_t &tag, property_map map) {
+    tag.map = std::move(map);
+}
+
+inline void
+set_tag_map(compact_tag_t &tag, property_map map) {
+    tag.payload = make_tag_payload(std::move(map));
+}
+
+/**
+ * @brief tag as seen by 'BatchedTags' nodes: 'index' is relative to the first new (i.e. non-history) input sample of the
+ * current 'process_bulk(..)' call. Tags on the same sample (e.g. of different input ports) are merged into one.
+ */
+struct relative_tag_t {
+    std::size_t  index = 0;
+    property_map map;
+};
+
 } // namespace fair::graph
 
 ENABLE_REFLECTION(fair::graph::tag_t, index, map);
@@ -155,8 +238,9 @@ inline EM_CONSTEXPR_STATIC default_tag<"trigger_name", std::string> TRIGGER_NAME
 inline EM_CONSTEXPR_STATIC default_tag<"trigger_time", uint64_t, "ns", "UTC-based time-stamp"> TRIGGER_TIME;
 inline EM_CONSTEXPR_STATIC default_tag<"trigger_offset", float, "s", "sample delay w.r.t. the trigger (e.g.compensating analog group delays)"> TRIGGER_OFFSET;
 inline EM_CONSTEXPR_STATIC default_tag<"context", std::string, "", "multiplexing key to orchestrate node settings/behavioural changes"> CONTEXT;
+inline EM_CONSTEXPR_STATIC default_tag<"n_dropped", uint64_t, "", "number of samples dropped before this sample due to a buffer overflow"> N_DROPPED;
 
-inline constexpr std::tuple DEFAULT_TAGS = { SAMPLE_RATE, SIGNAL_NAME, SIGNAL_UNIT, SIGNAL_MIN, SIGNAL_MAX, TRIGGER_NAME, TRIGGER_TIME, TRIGGER_OFFSET, CONTEXT };
+inline constexpr std::tuple DEFAULT_TAGS = { SAMPLE_RATE, SIGNAL_NAME, SIGNAL_UNIT, SIGNAL_MIN, SIGNAL_MAX, TRIGGER_NAME, TRIGGER_TIME, TRIGGER_OFFSET, CONTEXT, N_DROPPED };
 } // namespace tag
 
 } // namespace fair::graph
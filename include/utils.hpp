@@ -236,8 +236,11 @@ namespace detail {
 template<typename T, std::size_t N>
 using deduced_simd = stdx::simd<T, stdx::simd_abi::deduce_t<T, N>>;
 
+// non-vectorizable types (e.g. std::complex<T>) remain scalar, i.e. have a SIMD width of zero
 template<typename T, std::size_t N>
-struct simdize_impl;
+struct simdize_impl {
+    using type = T;
+};
 
 template<vectorizable_v T, std::size_t N>
     requires requires { typename stdx::native_simd<T>; }
@@ -267,7 +270,7 @@ struct simdize_impl<Tup, N> {
  * Meta-function that turns a vectorizable type or a tuple-like (recursively) of vectorizable types
  * into a stdx::simd or std::tuple (recursively) of stdx::simd. If N is non-zero, N determines the
  * resulting SIMD width. Otherwise, of all vectorizable types U the maximum
- * stdx::native_simd<U>::size() determines the resulting SIMD width.
+ * stdx::native_simd<U>::size() determines the resulting SIMD width. Non-vectorizable types are kept as-is.
  */
 template<typename T, std::size_t N = 0>
 using simdize = typename detail::simdize_impl<T, N>::type;
@@ -1,6 +1,7 @@
 #ifndef GNURADIO_WAIT_STRATEGY_HPP
 #define GNURADIO_WAIT_STRATEGY_HPP
 
+#include <algorithm>
 #include <condition_variable>
 #include <atomic>
 #include <chrono>
@@ -8,9 +9,18 @@
 #include <cstdint>
 #include <memory>
 #include <mutex>
+#include <system_error>
 #include <thread>
 #include <vector>
 
+#if defined __has_include && not __EMSCRIPTEN__
+#if __has_include(<sys/eventfd.h>) && __has_include(<unistd.h>)
+#include <sys/eventfd.h>
+#include <unistd.h>
+#define HAS_EVENTFD_INTERFACE
+#endif
+#endif
+
 #include "sequence.hpp"
 
 namespace gr {
@@ -182,6 +192,253 @@ public:
 static_assert(WaitStrategy<TimeoutBlockingWaitStrategy>);
 static_assert(hasSignalAllWhenBlocking<TimeoutBlockingWaitStrategy>);
 
+/**
+ * Blocking strategy that parks waiting threads on a 32-bit epoch counter via std::atomic::wait (i.e. a futex on Linux).
+ * Contrary to BlockingWaitStrategy, the publisher neither takes a lock nor does a syscall as long as nobody is waiting:
+ * signalAllWhenBlocking() only reads the waiter count and bumps/notifies the epoch if it is non-zero.
+ *
+ * With 'WithEventFd = true', the strategy additionally owns a non-blocking eventfd that can be registered with
+ * epoll/poll/select. Reactor-style consumers call arm() before going to sleep on the descriptor and consume_event()
+ * after being woken up -- the descriptor is only written to while at least one consumer is armed.
+ *
+ * @tparam WithEventFd additionally signal an eventfd for epoll-based consumers (Linux only)
+ */
+template<bool WithEventFd = false>
+class FutexWaitStrategy {
+    alignas(hardware_destructive_interference_size) std::atomic<std::uint32_t> _epoch{ 0 };
+    alignas(hardware_destructive_interference_size) std::atomic<std::uint32_t> _waiters{ 0 };
+    std::atomic<bool> _armed{ false };
+    int               _eventFd = -1;
+
+public:
+    FutexWaitStrategy() {
+        if constexpr (WithEventFd) {
+#ifdef HAS_EVENTFD_INTERFACE
+            if (_eventFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC); _eventFd < 0) {
+                throw std::system_error(errno, std::generic_category(), "FutexWaitStrategy - could not create eventfd");
+            }
+#else
+            throw std::system_error(std::make_error_code(std::errc::function_not_supported), "FutexWaitStrategy - eventfd is not supported on this platform");
+#endif
+        }
+    }
+    FutexWaitStrategy(const FutexWaitStrategy &)            = delete;
+    FutexWaitStrategy &operator=(const FutexWaitStrategy &) = delete;
+    ~FutexWaitStrategy() {
+#ifdef HAS_EVENTFD_INTERFACE
+        if (_eventFd >= 0) {
+            ::close(_eventFd);
+        }
+#endif
+    }
+
+    std::int64_t waitFor(const std::int64_t sequence, const Sequence &cursor, const std::vector<std::shared_ptr<Sequence>> &dependentSequences) {
+        while (cursor.value() < sequence) {
+            const std::uint32_t epoch = _epoch.load(std::memory_order_acquire);
+            _waiters.fetch_add(1, std::memory_order_seq_cst); // N.B. must be visible before re-checking the cursor, see signalAllWhenBlocking()
+            if (cursor.value() < sequence) {
+                _epoch.wait(epoch, std::memory_order_acquire);
+            }
+            _waiters.fetch_sub(1, std::memory_order_release);
+        }
+
+        std::int64_t availableSequence;
+        while ((availableSequence = detail::getMinimumSequence(dependentSequences)) < sequence) {
+            // optional: barrier check alert
+        }
+
+        return availableSequence;
+    }
+
+    void signalAllWhenBlocking() {
+        // pairs with the seq_cst increment in waitFor()/arm(): either the waiter sees the new cursor, or we see the waiter
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_waiters.load(std::memory_order_relaxed) == 0) [[likely]] {
+            return;
+        }
+        _epoch.fetch_add(1, std::memory_order_release);
+        _epoch.notify_all();
+#ifdef HAS_EVENTFD_INTERFACE
+        if (WithEventFd && _armed.exchange(false, std::memory_order_acq_rel)) {
+            _waiters.fetch_sub(1, std::memory_order_release);
+            const std::uint64_t increment = 1;
+            std::ignore                   = ::write(_eventFd, &increment, sizeof(increment)); // N.B. EAGAIN only if the counter is saturated
+        }
+#endif
+    }
+
+    /**
+     * @return eventfd descriptor to be registered with epoll/poll (readable after a publish while armed), -1 if 'WithEventFd == false'
+     */
+    [[nodiscard]] int  native_handle() const noexcept { return _eventFd; }
+
+    /**
+     * requests the next signalAllWhenBlocking() to write to the eventfd. N.B. re-check the buffer's availability after arming
+     * and before blocking on the descriptor to avoid missing a publish that happened in-between.
+     */
+    void arm() noexcept requires WithEventFd {
+        if (!_armed.exchange(true, std::memory_order_acq_rel)) {
+            _waiters.fetch_add(1, std::memory_order_seq_cst);
+        }
+    }
+
+    /**
+     * resets the eventfd after it became readable.
+     * @return number of signals accumulated since the last call
+     */
+    std::uint64_t consume_event() noexcept requires WithEventFd {
+        std::uint64_t count = 0;
+#ifdef HAS_EVENTFD_INTERFACE
+        if (::read(_eventFd, &count, sizeof(count)) != static_cast<ssize_t>(sizeof(count))) {
+            return 0; // EAGAIN: nothing pending
+        }
+#endif
+        return count;
+    }
+
+    [[nodiscard]] std::uint32_t n_waiters() const noexcept { return _waiters.load(std::memory_order_acquire); }
+};
+static_assert(WaitStrategy<FutexWaitStrategy<>>);
+static_assert(hasSignalAllWhenBlocking<FutexWaitStrategy<>>);
+
+using EventFdWaitStrategy = FutexWaitStrategy<true>;
+static_assert(WaitStrategy<EventFdWaitStrategy>);
+
+/**
+ * Adaptive blocking strategy that learns the typical time a consumer has to wait for the next publish on this buffer
+ * (exponentially-weighted moving average of the observed waits). Waiters spin for about twice that estimate -- clamped
+ * to [minSpin, maxSpin] -- and then park on a futex like FutexWaitStrategy. If the estimate exceeds 'maxSpin', i.e.
+ * the producer is slow compared to the cost of a context switch, waiters only spin for 'minSpin' before parking.
+ * The publish path is identical to FutexWaitStrategy (no lock and no syscall as long as nobody is parked).
+ *
+ * The accumulated spin/park times and wake-up counts are exposed via statistics() to tune buffers in the field, e.g.
+ * through the circular_buffer's 'wait_strategy()' accessor.
+ */
+class AdaptiveWaitStrategy {
+    using Clock                                     = std::chrono::steady_clock;
+    static constexpr std::int64_t kEstimateWeight   = 8; // EWMA: estimate += (sample - estimate) / kEstimateWeight
+    static constexpr std::int64_t kSpinsPerClockRead = 64;
+
+    alignas(hardware_destructive_interference_size) std::atomic<std::uint32_t> _epoch{ 0 };
+    alignas(hardware_destructive_interference_size) std::atomic<std::uint32_t> _waiters{ 0 };
+    alignas(hardware_destructive_interference_size) std::atomic<std::int64_t> _gapEstimate; // [ns]
+    std::atomic<std::int64_t>  _spinTime{ 0 };                                              // [ns]
+    std::atomic<std::int64_t>  _parkedTime{ 0 };                                            // [ns]
+    std::atomic<std::uint64_t> _nWaits{ 0 };
+    std::atomic<std::uint64_t> _nSpinHits{ 0 };
+    std::atomic<std::uint64_t> _nParks{ 0 };
+    std::atomic<std::uint64_t> _nWakeUps{ 0 };
+    const std::int64_t         _minSpin; // [ns]
+    const std::int64_t         _maxSpin; // [ns]
+
+    static void cpuRelax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+
+    void updateEstimate(std::int64_t sample) noexcept { // N.B. racy read-modify-write between concurrent waiters is acceptable for an estimate
+        sample                      = std::min(sample, 2 * _maxSpin); // anything beyond 'maxSpin' parks anyway, limits the impact of quiet periods
+        const std::int64_t estimate = _gapEstimate.load(std::memory_order_relaxed);
+        _gapEstimate.store(estimate + (sample - estimate) / kEstimateWeight, std::memory_order_relaxed);
+    }
+
+public:
+    struct statistics_t {
+        std::chrono::nanoseconds spin_time{ 0 };    /// accumulated time spent spinning
+        std::chrono::nanoseconds parked_time{ 0 };  /// accumulated time spent parked on the futex
+        std::uint64_t            waits     = 0;     /// number of waitFor() calls that could not return immediately
+        std::uint64_t            spin_hits = 0;     /// ... of which were satisfied while spinning
+        std::uint64_t            parks     = 0;     /// ... of which had to be parked
+        std::uint64_t            wake_ups  = 0;     /// futex wake-ups (including spurious ones)
+        std::chrono::nanoseconds gap_estimate{ 0 }; /// current estimate of the inter-publish gap
+    };
+
+    explicit AdaptiveWaitStrategy(std::chrono::nanoseconds minSpin = std::chrono::microseconds(1), std::chrono::nanoseconds maxSpin = std::chrono::microseconds(100))
+        : _gapEstimate(minSpin.count()), _minSpin(minSpin.count()), _maxSpin(std::max(minSpin, maxSpin).count()) {}
+    AdaptiveWaitStrategy(const AdaptiveWaitStrategy &)            = delete;
+    AdaptiveWaitStrategy &operator=(const AdaptiveWaitStrategy &) = delete;
+
+    std::int64_t waitFor(const std::int64_t sequence, const Sequence &cursor, const std::vector<std::shared_ptr<Sequence>> &dependentSequences) {
+        if (cursor.value() < sequence) {
+            const auto         start    = Clock::now();
+            const std::int64_t estimate = _gapEstimate.load(std::memory_order_relaxed);
+            const std::int64_t budget   = estimate > _maxSpin ? _minSpin : std::clamp(2 * estimate, _minSpin, _maxSpin);
+            std::int64_t       spun     = 0;
+            for (std::int64_t i = 1; cursor.value() < sequence; i++) {
+                cpuRelax();
+                if (i % kSpinsPerClockRead == 0 && (spun = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count()) >= budget) {
+                    break;
+                }
+            }
+
+            _nWaits.fetch_add(1, std::memory_order_relaxed);
+            if (cursor.value() >= sequence) {
+                spun = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+                _spinTime.fetch_add(spun, std::memory_order_relaxed);
+                _nSpinHits.fetch_add(1, std::memory_order_relaxed);
+                updateEstimate(spun);
+            } else {
+                _nParks.fetch_add(1, std::memory_order_relaxed);
+                while (cursor.value() < sequence) {
+                    const std::uint32_t epoch = _epoch.load(std::memory_order_acquire);
+                    _waiters.fetch_add(1, std::memory_order_seq_cst); // N.B. must be visible before re-checking the cursor, see signalAllWhenBlocking()
+                    if (cursor.value() < sequence) {
+                        _epoch.wait(epoch, std::memory_order_acquire);
+                        _nWakeUps.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    _waiters.fetch_sub(1, std::memory_order_release);
+                }
+                const std::int64_t total = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+                _spinTime.fetch_add(spun, std::memory_order_relaxed);
+                _parkedTime.fetch_add(total - spun, std::memory_order_relaxed);
+                updateEstimate(total);
+            }
+        }
+
+        std::int64_t availableSequence;
+        while ((availableSequence = detail::getMinimumSequence(dependentSequences)) < sequence) {
+            // optional: barrier check alert
+        }
+
+        return availableSequence;
+    }
+
+    void signalAllWhenBlocking() {
+        std::atomic_thread_fence(std::memory_order_seq_cst); // see FutexWaitStrategy::signalAllWhenBlocking()
+        if (_waiters.load(std::memory_order_relaxed) == 0) [[likely]] {
+            return;
+        }
+        _epoch.fetch_add(1, std::memory_order_release);
+        _epoch.notify_all();
+    }
+
+    [[nodiscard]] statistics_t statistics() const noexcept {
+        return { .spin_time    = std::chrono::nanoseconds(_spinTime.load(std::memory_order_relaxed)),
+                 .parked_time  = std::chrono::nanoseconds(_parkedTime.load(std::memory_order_relaxed)),
+                 .waits        = _nWaits.load(std::memory_order_relaxed),
+                 .spin_hits    = _nSpinHits.load(std::memory_order_relaxed),
+                 .parks        = _nParks.load(std::memory_order_relaxed),
+                 .wake_ups     = _nWakeUps.load(std::memory_order_relaxed),
+                 .gap_estimate = std::chrono::nanoseconds(_gapEstimate.load(std::memory_order_relaxed)) };
+    }
+
+    void reset_statistics() noexcept {
+        _spinTime.store(0, std::memory_order_relaxed);
+        _parkedTime.store(0, std::memory_order_relaxed);
+        _nWaits.store(0, std::memory_order_relaxed);
+        _nSpinHits.store(0, std::memory_order_relaxed);
+        _nParks.store(0, std::memory_order_relaxed);
+        _nWakeUps.store(0, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::uint32_t n_waiters() const noexcept { return _waiters.load(std::memory_order_acquire); }
+};
+static_assert(WaitStrategy<AdaptiveWaitStrategy>);
+static_assert(hasSignalAllWhenBlocking<AdaptiveWaitStrategy>);
+
 /**
  * Yielding strategy that uses a Thread.Yield() for IEventProcessors waiting on a barrier after an initially spinning.
  * This strategy is a good compromise between performance and CPU resource without incurring significant latency spikes.
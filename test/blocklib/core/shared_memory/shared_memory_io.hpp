@@ -0,0 +1,85 @@
+#ifndef GRAPH_PROTOTYPE_SHARED_MEMORY_IO_HPP
+#define GRAPH_PROTOTYPE_SHARED_MEMORY_IO_HPP
+
+#include <node.hpp>
+#include <shared_circular_buffer.hpp>
+
+namespace gr::blocks::shared_memory {
+
+using namespace fair::graph;
+
+/**
+ * @brief writes its input stream into a shared_circular_buffer that is read by another process (see shared_memory_source)
+ *
+ * Usage (producer process):
+ *   shared_circular_buffer<float> shared(65536);
+ *   shm::send_fd(socket, shared.native_handle());
+ *   auto &sink = graph.make_node<shared_memory_sink<float>>(shared);
+ *
+ * N.B. one copy from the graph's port buffer into the shared buffer, the consumer process reads it in-place.
+ */
+template<typename T>
+struct shared_memory_sink : node<shared_memory_sink<T>> {
+    IN<T>                     in;
+    shared_circular_buffer<T> _shared;
+    decltype(_shared.new_writer()) _writer;
+
+    explicit shared_memory_sink(shared_circular_buffer<T> shared) : _shared(std::move(shared)), _writer(_shared.new_writer()) {}
+
+    work_return_t
+    work() noexcept {
+        auto             &reader    = in.streamReader();
+        const std::size_t n_readable = reader.available();
+        if (n_readable == 0) {
+            return work_return_t::INSUFFICIENT_INPUT_ITEMS;
+        }
+        if (_shared.n_readers() == 0) {
+            return work_return_t::INSUFFICIENT_OUTPUT_ITEMS; // N.B. no remote reader attached (yet): the writer would discard the samples
+        }
+        const auto input = reader.get(std::min(n_readable, _writer.available()));
+        if (input.empty()) {
+            return work_return_t::INSUFFICIENT_OUTPUT_ITEMS; // remote reader(s) did not keep up
+        }
+        _writer.publish([&input](std::span<T> &output) { std::copy(input.begin(), input.end(), output.begin()); }, input.size());
+        return reader.consume(input.size()) ? work_return_t::OK : work_return_t::ERROR;
+    }
+};
+
+/**
+ * @brief publishes the samples written into a shared_circular_buffer by another process (see shared_memory_sink)
+ *
+ * Usage (consumer process):
+ *   auto &source = graph.make_node<shared_memory_source<float>>(shared_circular_buffer<float>::attach(shm::receive_fd(socket)));
+ *
+ * Returns DONE once the remote writer detached and all samples have been forwarded.
+ */
+template<typename T>
+struct shared_memory_source : node<shared_memory_source<T>> {
+    OUT<T>                    out;
+    shared_circular_buffer<T> _shared;
+    decltype(_shared.new_reader()) _reader;
+
+    explicit shared_memory_source(shared_circular_buffer<T> shared) : _shared(std::move(shared)), _reader(_shared.new_reader()) {}
+
+    work_return_t
+    work() noexcept {
+        if (_reader.end_of_stream()) {
+            return work_return_t::DONE;
+        }
+        auto             &writer = out.streamWriter();
+        const std::size_t n      = std::min(_reader.available(), writer.available());
+        if (n == 0) {
+            return _reader.available() == 0 ? work_return_t::INSUFFICIENT_INPUT_ITEMS : work_return_t::INSUFFICIENT_OUTPUT_ITEMS;
+        }
+        const auto input = _reader.get(n);
+        writer.publish([&input](std::span<T> &output) { std::copy(input.begin(), input.end(), output.begin()); }, input.size());
+        return _reader.consume(input.size()) ? work_return_t::OK : work_return_t::ERROR;
+    }
+};
+
+} // namespace gr::blocks::shared_memory
+
+ENABLE_REFLECTION_FOR_TEMPLATE_FULL((typename T), (gr::blocks::shared_memory::shared_memory_sink<T>), in);
+ENABLE_REFLECTION_FOR_TEMPLATE_FULL((typename T), (gr::blocks::shared_memory::shared_memory_source<T>), out);
+
+#endif // GRAPH_PROTOTYPE_SHARED_MEMORY_IO_HPP
@@ -5,6 +5,7 @@
 #include <complex>
 #include <numeric>
 #include <ranges>
+#include <thread>
 #include <tuple>
 
 #include <fmt/format.h>
@@ -15,6 +16,7 @@
 #include <circular_buffer.hpp>
 #include <history_buffer.hpp>
 #include <sequence.hpp>
+#include <shared_circular_buffer.hpp>
 #include <wait_strategy.hpp>
 
 #if defined(__clang__) && __clang_major__ >= 16
@@ -128,6 +130,32 @@ const boost::ut::suite SequenceTests = [] {
         expect(nothrow([&sequences, &s3] { gr::detail::removeSequence(sequences, s3); }));
         expect(eq(sequences->size(), std::size_t{ 1 }));
 
+        SequenceTable table;
+        expect(table.empty());
+        expect(eq(table.getMinimum(), std::numeric_limits<signed_index_type>::max()));
+        expect(eq(gr::detail::getMinimumSequence(table, 2), signed_index_type{ 2 }));
+        std::vector<SequenceTable::Slot> slots;
+        for (std::size_t i = 0; i < 2 * SequenceTable::kBlockSize + 1; i++) { // spans more than one block
+            slots.emplace_back(table.add(*cursor));
+        }
+        expect(eq(table.size(), 2 * SequenceTable::kBlockSize + 1));
+        // newly added sequences are set automatically to the cursor/write position
+        expect(eq(slots.back().value(), signed_index_type{ 10 }));
+        expect(eq(table.getMinimum(), signed_index_type{ 10 }));
+        slots.back().setValue(3);
+        expect(eq(table.getMinimum(), signed_index_type{ 3 }));
+        expect(eq(table.getMinimum(2), signed_index_type{ 2 }));
+        expect(table.remove(slots.back()));
+        expect(not slots.back());
+        expect(not table.remove(slots.back()));
+        expect(eq(table.getMinimum(), signed_index_type{ 10 }));
+        expect(eq(slots.front().addAndGet(2), signed_index_type{ 12 }));
+        for (auto &slot : slots) {
+            table.remove(slot);
+        }
+        expect(table.empty());
+        expect(eq(table.getMinimum(), std::numeric_limits<signed_index_type>::max())) << "released slots do not gate";
+
         std::stringstream ss;
         expect(eq(ss.str().size(), std::size_t{ 0 }));
         expect(nothrow([&ss, &s3] { ss << fmt::format("{}", *s3); }));
@@ -151,6 +179,87 @@ const boost::ut::suite DoubleMappedAllocatorTests = [] {
             // to note: can safely read beyond size for this special vector
             expect(eq(vec[size + i], vec[i])); // identical to mirrored copy
         }
+        expect(eq(gr::double_mapped_memory_resource::defaultAllocator()->page_size(vec.data()), static_cast<std::size_t>(getpagesize())));
+        expect(eq(gr::double_mapped_memory_resource::defaultAllocator()->page_size(nullptr), static_cast<std::size_t>(getpagesize()))) << "standard pages are not tracked";
+    };
+
+    "DoubleMappedHugePageAllocator"_test = [] {
+        using Allocator                                 = std::pmr::polymorphic_allocator<int32_t>;
+        auto                           *resource        = gr::double_mapped_memory_resource::hugePageAllocator();
+        const std::size_t               hugePageSize    = gr::double_mapped_memory_resource::huge_page_size();
+        expect(resource->uses_huge_pages());
+        expect(eq(resource->page_size(), hugePageSize));
+        expect(ge(hugePageSize, static_cast<std::size_t>(getpagesize())));
+
+        // N.B. falls back to (transparent) standard pages if the system has no reserved huge pages
+        const std::size_t               size            = hugePageSize / sizeof(int32_t);
+        std::vector<int32_t, Allocator> vec(size, gr::double_mapped_memory_resource::allocator<int32_t>(true));
+        const std::size_t               obtainedPageSize = resource->page_size(vec.data());
+        expect(obtainedPageSize == hugePageSize || obtainedPageSize == static_cast<std::size_t>(getpagesize())) << "obtained page size:" << obtainedPageSize;
+        expect(eq(reinterpret_cast<std::uintptr_t>(vec.data()) % hugePageSize, 0LU)) << "mapping is huge-page aligned";
+        std::iota(vec.begin(), vec.end(), 1);
+        for (auto i = 0U; i < vec.size(); i++) {
+            expect(eq(vec[size + i], vec[i])); // identical to mirrored copy
+        }
+
+        gr::circular_buffer<int32_t> buffer(1024, gr::double_mapped_memory_resource::allocator<int32_t>(true));
+        expect(eq(buffer.size() * sizeof(int32_t) % hugePageSize, 0LU));
+        expect(eq(buffer.page_size() == hugePageSize || buffer.page_size() == static_cast<std::size_t>(getpagesize()), true));
+        auto writer = buffer.new_writer();
+        auto reader = buffer.new_reader();
+        for (std::size_t n = 0; n < 2 * buffer.size(); n += buffer.size() / 2) { // wraps around twice
+            writer.publish([n](std::span<int32_t> data) { std::iota(data.begin(), data.end(), static_cast<int32_t>(n)); }, buffer.size() / 2);
+            const auto in = reader.get();
+            expect(eq(in.size(), buffer.size() / 2));
+            expect(eq(in.front(), static_cast<int32_t>(n)));
+            expect(eq(in.back(), static_cast<int32_t>(n + buffer.size() / 2 - 1)));
+            expect(reader.consume(in.size()));
+        }
+    };
+
+    "CachingDoubleMappedAllocator"_test = [] {
+        using Allocator                 = std::pmr::polymorphic_allocator<int32_t>;
+        const std::size_t        size   = static_cast<std::size_t>(getpagesize()) / sizeof(int32_t);
+        const std::size_t        nBytes = size * sizeof(int32_t);
+        gr::caching_double_mapped_memory_resource resource(2 * nBytes);
+        expect(eq(resource.cap(), 2 * nBytes));
+
+        const int32_t *firstAddress = nullptr;
+        {
+            std::vector<int32_t, Allocator> vec(size, Allocator(&resource));
+            firstAddress = vec.data();
+            std::iota(vec.begin(), vec.end(), 1);
+            expect(eq(vec[size], 1)); // mirrored copy
+        }
+        expect(eq(resource.statistics().misses, 1UL));
+        expect(eq(resource.statistics().cached_allocations, 1UL));
+        expect(eq(resource.statistics().cached_bytes, nBytes));
+        {
+            std::vector<int32_t, Allocator> vec(size, Allocator(&resource)); // recycled mapping
+            expect(eq(vec.data(), firstAddress));
+            vec[0] = 42;
+            expect(eq(vec[size], 42)); // recycled mapping is still mirrored
+        }
+        expect(eq(resource.statistics().hits, 1UL));
+        expect(eq(resource.statistics().misses, 1UL));
+
+        { // different sizes are cached in separate buckets, releases exceeding the cap are unmapped
+            std::vector<int32_t, Allocator> vec1(size, Allocator(&resource));
+            std::vector<int32_t, Allocator> vec2(size, Allocator(&resource));
+            std::vector<int32_t, Allocator> vec3(2 * size, Allocator(&resource));
+        }
+        const auto stats = resource.statistics();
+        expect(eq(stats.hits, 2UL));
+        expect(eq(stats.misses, 3UL));
+        expect(eq(stats.cached_bytes, 2 * nBytes)); // N.B. vec3 is released first and fills the cache
+        expect(eq(stats.cached_allocations, 1UL));
+        expect(eq(stats.evictions, 2UL));
+
+        resource.release();
+        expect(eq(resource.statistics().cached_allocations, 0UL));
+        expect(eq(resource.statistics().cached_bytes, 0UL));
+        resource.reset_statistics();
+        expect(eq(resource.statistics().hits, 0UL));
     };
 };
 #endif
@@ -177,11 +286,154 @@ const boost::ut::suite WaitStrategiesTests = [] {
         expect(WaitStrategy<SpinWaitWaitStrategy>);
         expect(WaitStrategy<TimeoutBlockingWaitStrategy>);
         expect(WaitStrategy<YieldingWaitStrategy>);
+        expect(WaitStrategy<FutexWaitStrategy<>>);
+        expect(WaitStrategy<AdaptiveWaitStrategy>);
         expect(not WaitStrategy<int>);
 
         TestStruct a;
         expect(a.test());
     };
+
+    "FutexWaitStrategy"_test = [] {
+        using namespace gr;
+        FutexWaitStrategy<>                    strategy;
+        Sequence                               cursor;
+        std::vector<std::shared_ptr<Sequence>> dependents{ std::make_shared<Sequence>(42) };
+
+        std::atomic<std::int64_t>              available{ kInitialCursorValue };
+        std::thread                            waiter([&] { available = strategy.waitFor(5, cursor, dependents); });
+        while (strategy.n_waiters() == 0) {
+            std::this_thread::yield();
+        }
+        cursor.setValue(3); // not yet sufficient
+        strategy.signalAllWhenBlocking();
+        cursor.setValue(5);
+        strategy.signalAllWhenBlocking();
+        waiter.join();
+        expect(eq(available.load(), 42L));
+        expect(eq(strategy.n_waiters(), 0U));
+
+        circular_buffer<int32_t, std::dynamic_extent, ProducerType::Single, FutexWaitStrategy<>> buffer(1024);
+        BufferWriter auto                                                                       writer = buffer.new_writer();
+        BufferReader auto                                                                       reader = buffer.new_reader();
+        writer.publish([](auto &w) { std::iota(w.begin(), w.end(), 0); }, 16);
+        expect(eq(reader.available(), 16UL));
+    };
+
+    "AdaptiveWaitStrategy"_test = [] {
+        using namespace gr;
+        AdaptiveWaitStrategy                   strategy;
+        Sequence                               cursor;
+        std::vector<std::shared_ptr<Sequence>> dependents;
+        constexpr std::int64_t                 nSequences = 1000;
+
+        std::thread                            waiter([&] {
+            for (std::int64_t sequence = 0; sequence < nSequences; sequence++) {
+                std::ignore = strategy.waitFor(sequence, cursor, dependents);
+            }
+        });
+        for (std::int64_t sequence = 0; sequence < nSequences; sequence++) {
+            if (sequence % 100 == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1)); // force some parks
+            }
+            cursor.setValue(sequence);
+            strategy.signalAllWhenBlocking();
+        }
+        waiter.join();
+
+        const auto stats = strategy.statistics();
+        expect(eq(stats.waits, stats.spin_hits + stats.parks));
+        expect(le(stats.gap_estimate, std::chrono::nanoseconds(std::chrono::microseconds(200))));
+        expect(eq(strategy.n_waiters(), 0U));
+
+        strategy.reset_statistics();
+        expect(eq(strategy.statistics().waits, 0UL));
+        expect(eq(strategy.statistics().spin_time.count(), 0L));
+    };
+
+    "AdaptiveWaitStrategy spin/park transitions"_test = [] {
+        using namespace gr;
+        using namespace std::chrono_literals;
+        std::vector<std::shared_ptr<Sequence>> dependents;
+
+        // publish within the spin budget -> satisfied while spinning, no park, and the gap estimate adapts downwards
+        {
+            AdaptiveWaitStrategy strategy(1s, 1s);
+            Sequence             cursor;
+            std::atomic<bool>    waiting{ false };
+            std::thread          waiter([&] {
+                waiting = true;
+                std::ignore = strategy.waitFor(0, cursor, dependents);
+            });
+            while (!waiting) {
+                std::this_thread::yield();
+            }
+            std::this_thread::sleep_for(1ms); // N.B. well within the 1 s spin budget
+            cursor.setValue(0);
+            waiter.join();
+            const auto stats = strategy.statistics();
+            expect(eq(stats.waits, 1UL));
+            expect(eq(stats.spin_hits, 1UL));
+            expect(eq(stats.parks, 0UL));
+            expect(eq(stats.wake_ups, 0UL));
+            expect(eq(stats.parked_time.count(), 0L));
+            expect(lt(stats.gap_estimate, std::chrono::nanoseconds(1s))) << "estimate follows the observed (shorter) gap";
+        }
+
+        // publish beyond the spin budget -> spins, parks on the futex, and is woken up by 'signalAllWhenBlocking()'
+        {
+            constexpr auto         minSpin = std::chrono::nanoseconds(1us);
+            constexpr auto         maxSpin = std::chrono::nanoseconds(100us);
+            AdaptiveWaitStrategy   strategy(minSpin, maxSpin);
+            Sequence               cursor;
+            constexpr std::int64_t nSequences = 8;
+            std::thread            waiter([&] {
+                for (std::int64_t sequence = 0; sequence < nSequences; sequence++) {
+                    std::ignore = strategy.waitFor(sequence, cursor, dependents);
+                }
+            });
+            for (std::int64_t sequence = 0; sequence < nSequences; sequence++) {
+                // N.B. only parked waiters are registered, the park counter distinguishes this from the previous wait
+                while (strategy.statistics().parks <= static_cast<std::uint64_t>(sequence) || strategy.n_waiters() == 0) {
+                    std::this_thread::yield();
+                }
+                std::this_thread::sleep_for(1ms); // let the waiter block on the futex
+                cursor.setValue(sequence);
+                strategy.signalAllWhenBlocking();
+            }
+            waiter.join();
+            const auto stats = strategy.statistics();
+            expect(eq(stats.waits, static_cast<std::uint64_t>(nSequences)));
+            expect(eq(stats.spin_hits, 0UL));
+            expect(eq(stats.parks, static_cast<std::uint64_t>(nSequences)));
+            expect(gt(stats.wake_ups, 0UL)) << "woken up via the futex";
+            expect(gt(stats.parked_time.count(), 0L));
+            expect(gt(stats.spin_time.count(), 0L)) << "spins before parking";
+            // repeated long gaps push the estimate beyond 'maxSpin', i.e. subsequent waits park after spinning only 'minSpin'
+            expect(gt(stats.gap_estimate, maxSpin));
+            expect(eq(strategy.n_waiters(), 0U));
+        }
+    };
+
+#ifdef HAS_EVENTFD_INTERFACE
+    "EventFdWaitStrategy"_test = [] {
+        using namespace gr;
+        EventFdWaitStrategy strategy;
+        expect(ge(strategy.native_handle(), 0));
+
+        strategy.signalAllWhenBlocking(); // not armed -> no write to the eventfd
+        expect(eq(strategy.consume_event(), 0UL));
+
+        strategy.arm();
+        expect(eq(strategy.n_waiters(), 1U));
+        strategy.signalAllWhenBlocking();
+        expect(eq(strategy.consume_event(), 1UL));
+        expect(eq(strategy.n_waiters(), 0U));
+
+        strategy.signalAllWhenBlocking(); // disarmed after the first signal
+        expect(eq(strategy.consume_event(), 0UL));
+    };
+#endif
 };
 
 const boost::ut::suite UserApiExamples = [] {
@@ -280,6 +532,7 @@ const boost::ut::suite CircularBufferTests = [] {
 
                 // full buffer: fill buffer need to fail/return 'false'
                 expect(not writer.try_publish(lambda, buffer.size()));
+                expect(writer.try_reserve_output_range(1).empty()) << "non-blocking reservation on a full buffer";
 
                 expect(reader.consume(buffer.size()));
                 expect(eq(reader.available(), std::size_t{ 0 }));
@@ -357,8 +610,385 @@ const boost::ut::suite CircularBufferTests = [] {
 #endif
                   Allocator()
               };
+
+    "CircularBuffer - split wrap mode"_test = [] {
+        using namespace gr;
+        Buffer auto buffer = circular_buffer<int32_t>(1024, Allocator(), WrapMode::Split);
+        expect(buffer.wrap_mode() == WrapMode::Split);
+        expect(circular_buffer<int32_t>(1024, Allocator()).wrap_mode() == WrapMode::Mirrored);
+        BufferWriter auto writer  = buffer.new_writer();
+        BufferReader auto reader  = buffer.new_reader();
+        int32_t           counter = 0;
+
+        // N.B. 300 samples do not divide the buffer size -> publications straddle the wrap-around point
+        for (std::size_t i = 0; i < 2 * buffer.size() / 300; i++) {
+            if (i % 2 == 0) { // lambda API: translator is invoked once per contiguous span
+                writer.publish([&counter](std::span<int32_t> &writable) { std::iota(writable.begin(), writable.end(), std::exchange(counter, counter + static_cast<int32_t>(writable.size()))); }, 300);
+            } else { // RAII API: index operator wraps around
+                auto data = writer.reserve_output_range(300);
+                expect(eq(data.spans()[0].size() + data.spans()[1].size(), std::size_t{ 300 }));
+                for (std::size_t j = 0; j < data.size(); j++) {
+                    data[j] = counter++;
+                }
+                data.publish(300);
+            }
+            expect(eq(reader.available(), std::size_t{ 300 }));
+            const auto spans = reader.get_spans(300);
+            expect(eq(spans[0].size() + spans[1].size(), std::size_t{ 300 }));
+            expect(eq(reader.get().size(), spans[0].size())) << "contiguous get() is limited to the wrap-around point";
+            expect(le(spans[0].size(), reader.samples_to_wrap()));
+            int32_t expected = counter - 300;
+            for (const auto &span : spans) {
+                for (const int32_t value : span) {
+                    expect(eq(value, expected++));
+                }
+            }
+            expect(reader.consume(300));
+        }
+    };
+
+    "CircularBuffer - monitor reader"_test = [] {
+        using namespace gr;
+        circular_buffer<int32_t> buffer(1024);
+        BufferWriter auto        writer  = buffer.new_writer();
+        BufferReader auto        monitor = buffer.new_reader(ReaderMode::Monitor);
+        expect(eq(buffer.n_readers(), 0UL));
+        expect(eq(buffer.n_monitor_readers(), 1UL));
+
+        // writer must never block on the monitor, even when lapping it several times
+        int32_t value = 0;
+        for (std::size_t i = 0; i < 10; i++) {
+            writer.publish([&value](std::span<int32_t> &w) { std::iota(w.begin(), w.end(), value); value += static_cast<int32_t>(w.size()); }, buffer.size() / 2);
+        }
+        expect(eq(monitor.available(), buffer.size() / 2)) << "skipped forward to the latest data";
+        expect(eq(monitor.n_dropped(), 9 * buffer.size() / 2));
+        const auto data = monitor.get();
+        expect(eq(data.back(), value - 1));
+        expect(monitor.consume(data.size()));
+        expect(eq(monitor.available(), 0UL));
+
+        BufferReader auto gating = buffer.new_reader();
+        writer.publish([](std::span<int32_t> &w) { std::ranges::fill(w, 42); }, 10);
+        expect(eq(gating.available(), 10UL));
+        expect(eq(monitor.available(), 10UL));
+        expect(eq(gating.n_dropped(), 0UL));
+    };
+
+    "CircularBuffer - multi-producer publication"_test = [] {
+        using namespace gr;
+        for (std::size_t size : { 32UL, 1024UL }) { // N.B. < 64 slots: round boundaries within one availability word
+            circular_buffer<int32_t, std::dynamic_extent, ProducerType::Multi> buffer(size, std::pmr::polymorphic_allocator<int32_t>());
+            BufferWriter auto writer1 = buffer.new_writer();
+            BufferWriter auto writer2 = buffer.new_writer();
+            BufferReader auto reader  = buffer.new_reader();
+            for (std::size_t round = 0; round < 4; round++) {
+                auto range = writer1.reserve_output_range(10); // claimed but not yet published
+                writer2.publish([](std::span<int32_t> &w) { std::ranges::fill(w, 2); }, 5);
+                expect(eq(reader.available(), 0UL)) << "samples behind an unpublished claim must not be readable";
+
+                std::ranges::fill(range, 1);
+                range.publish(10);
+                expect(eq(reader.available(), 15UL));
+                const auto data = reader.get();
+                expect(eq(data[0], 1) and eq(data[9], 1) and eq(data[10], 2) and eq(data[14], 2));
+                expect(reader.consume(15));
+
+                writer1.publish([](std::span<int32_t> &) {}, buffer.size() - 15); // -> next round
+                expect(eq(reader.available(), buffer.size() - 15));
+                expect(reader.consume(buffer.size() - 15));
+            }
+        }
+    };
+
+    "CircularBuffer - batched multi-producer claims"_test = [] {
+        using namespace gr;
+        circular_buffer<int32_t, std::dynamic_extent, ProducerType::MultiBatched> buffer(1024, std::pmr::polymorphic_allocator<int32_t>());
+        const auto        batchSize = static_cast<Sequence::signed_index_type>(buffer.claim_strategy().batchSize());
+        BufferWriter auto writer1   = buffer.new_writer();
+        BufferWriter auto writer2   = buffer.new_writer();
+        BufferReader auto reader    = buffer.new_reader();
+        expect(batchSize > 1);
+
+        writer1.publish([](std::span<int32_t> &w) { std::ranges::fill(w, 1); }, 3);
+        expect(eq(buffer.cursor_sequence().value(), batchSize - 1)) << "first claim reserves a whole block";
+        writer1.publish([](std::span<int32_t> &w) { std::ranges::fill(w, 1); }, 2);
+        expect(eq(buffer.cursor_sequence().value(), batchSize - 1)) << "sub-allocated w/o touching the cursor";
+        writer2.publish([](std::span<int32_t> &w) { std::ranges::fill(w, 2); }, 2);
+        expect(eq(reader.available(), 5UL)) << "samples behind writer1's unused tail must not be readable";
+
+        writer1.flush(); // writer2 claimed after writer1's block -> unused tail becomes a gap
+        expect(eq(reader.available(), 5UL));
+        expect(std::ranges::all_of(reader.get(), [](int32_t v) { return v == 1; }));
+        expect(reader.consume(5));
+        expect(eq(reader.available(), 2UL)) << "gap is skipped";
+        expect(std::ranges::all_of(reader.get(), [](int32_t v) { return v == 2; }));
+        expect(reader.consume(2));
+
+        writer2.flush(); // no claims after writer2's block -> unused tail is returned to the cursor
+        expect(eq(buffer.cursor_sequence().value(), batchSize + 1));
+        expect(eq(reader.available(), 0UL));
+
+        for (std::size_t i = 0; i < 4 * buffer.size(); i++) { // gaps across several rounds
+            writer1.publish([i](std::span<int32_t> &w) { w[0] = static_cast<int32_t>(i); }, 1);
+            writer2.publish([](std::span<int32_t> &w) { w[0] = -1; }, 1);
+            writer2.flush();
+            writer1.flush();
+            expect(eq(reader.available(), 1UL));
+            expect(eq(reader.get()[0], static_cast<int32_t>(i)));
+            expect(reader.consume(1));
+            expect(eq(reader.available(), 1UL));
+            expect(eq(reader.get()[0], -1));
+            expect(reader.consume(1));
+        }
+    };
+
+    "CircularBuffer - reader look-back"_test = [] {
+        using namespace gr;
+        constexpr std::size_t nHistory = 4;
+        circular_buffer<int32_t> buffer(1024);
+        BufferWriter auto writer  = buffer.new_writer();
+        BufferReader auto reader  = buffer.new_reader(ReaderMode::Gating, nHistory);
+        BufferReader auto reader2 = buffer.new_reader();
+        const std::size_t size    = buffer.size();
+        expect(eq(reader.n_history(), nHistory));
+        expect(eq(writer.available(), size - nHistory)) << "writer is gated on the reader's position - history";
+
+        int32_t    value = 1;
+        const auto fill  = [&value](std::span<int32_t> &w) { std::ranges::for_each(w, [&value](int32_t &v) { v = value++; }); };
+        writer.publish(fill, 10);
+        auto data = reader.get_history();
+        expect(eq(data.size(), nHistory + 10));
+        expect(eq(data[0], 0) and eq(data[nHistory - 1], 0)) << "history of a new reader is value-initialised";
+        expect(eq(data[nHistory], 1) and eq(data.back(), 10));
+        expect(eq(reader.get().front(), 1)) << "get() is unaffected by the look-back";
+        expect(reader.consume(6));
+        data = reader.get_history(2);
+        expect(eq(data.size(), nHistory + 2));
+        expect(eq(data[0], 3) and eq(data[nHistory - 1], 6) and eq(data[nHistory], 7));
+
+        for (std::size_t round = 0; round < 4; round++) { // across the wrap-around point
+            expect(reader2.consume(reader2.available()));
+            expect(reader.consume(reader.available()));
+            writer.publish(fill, writer.available());
+            expect(eq(writer.available(), 0UL));
+            data = reader.get_history();
+            expect(eq(data.size(), size));
+            expect(std::ranges::adjacent_find(data, [](int32_t a, int32_t b) { return b != a + 1; }) == data.end());
+            expect(eq(data.back(), value - 1));
+        }
+    };
+
+    "CircularBuffer - online resize"_test = [] {
+        using namespace gr;
+        constexpr std::size_t nHistory = 4;
+        circular_buffer<int32_t> buffer(1024);
+        BufferWriter auto writer  = buffer.new_writer();
+        BufferReader auto reader  = buffer.new_reader(ReaderMode::Gating, nHistory);
+        BufferReader auto reader2 = buffer.new_reader();
+        const std::size_t size    = buffer.size();
+        int32_t           value   = 0;
+        const auto        fill    = [&value](std::span<int32_t> &w) { std::iota(w.begin(), w.end(), value); value += static_cast<int32_t>(w.size()); };
+
+        writer.publish(fill, size - nHistory);
+        expect(reader.consume(100));
+        expect(reader2.consume(10));
+        const auto position = reader.position();
+
+        writer.resize(4 * size);
+        expect(eq(writer.buffer().size(), 4 * size));
+        expect(eq(writer.buffer().n_readers(), 2UL)) << "gating slots are claimed on behalf of the readers";
+        expect(eq(writer.available(), 4 * size - (size - nHistory - 10))) << "unconsumed samples are kept";
+        expect(eq(buffer.n_readers(), 2UL)) << "readers did not yet access the buffer";
+
+        expect(eq(reader.position(), position));
+        expect(eq(reader2.available(), size - nHistory - 10));
+        expect(eq(reader2.get().front(), 10));
+        const auto history = reader.get_history();
+        expect(eq(history.size(), nHistory + size - nHistory - 100));
+        expect(eq(history[0], 96) and eq(history[nHistory], 100) and eq(history.back(), static_cast<int32_t>(size - nHistory - 1)));
+        expect(eq(buffer.n_readers(), 0UL)) << "readers moved to the new buffer";
+        expect(eq(writer.buffer().n_readers(), 2UL));
+
+        for (std::size_t round = 0; round < 3; round++) { // across the new wrap-around point
+            expect(reader.consume(reader.available()));
+            expect(reader2.consume(reader2.available()));
+            writer.publish(fill, writer.available());
+            const auto data = reader2.get();
+            expect(eq(data.size(), 4 * size - nHistory));
+            expect(std::ranges::adjacent_find(data, [](int32_t a, int32_t b) { return b != a + 1; }) == data.end());
+            expect(eq(data.back(), value - 1));
+        }
+
+        expect(throws<std::length_error>([&writer, size] { writer.resize(size); })) << "unconsumed samples exceed the new size";
+        expect(reader.consume(reader.available() - 100));
+        expect(reader2.consume(reader2.available() - 100));
+        {
+            BufferReader auto reader3 = writer.buffer().new_reader();
+            writer.resize(size);
+            expect(eq(writer.buffer().n_readers(), 3UL));
+        }
+        expect(eq(writer.buffer().n_readers(), 2UL)) << "slot is released if the reader is destroyed before it moved";
+        expect(eq(reader2.available(), 100UL));
+        expect(eq(reader2.get().front(), value - 100) and eq(reader2.get().back(), value - 1));
+        expect(eq(reader.get_history()[0], value - 100 - static_cast<int32_t>(nHistory)));
+    };
+
+    "CircularBuffer - memory locking"_test = [] {
+        using namespace gr;
+        // N.B. pinning may fail depending on 'RLIMIT_MEMLOCK' (see 'ulimit -l'), the memory is prefaulted either way
+        circular_buffer<int32_t> buffer(1024);
+        expect(!buffer.is_memory_locked());
+        const memory_lock_result result = buffer.lock_memory();
+        expect(buffer.is_memory_locked());
+        expect(eq(result.locked_bytes + result.failed_bytes, 2 * buffer.size() * sizeof(int32_t))) << "both double-mapped copies";
+        expect(eq(result.ok(), result.failed_bytes == 0));
+
+        BufferWriter auto writer = buffer.new_writer();
+        writer.resize(4 * buffer.size());
+        expect(writer.buffer().is_memory_locked()) << "resized buffer is pinned as well";
+
+        double_mapped_memory_resource resource(false, true);
+        {
+            circular_buffer<int32_t> locked(1024, std::pmr::polymorphic_allocator<int32_t>(&resource));
+            const auto               statistics = resource.lock_statistics();
+            expect(eq(statistics.locked_bytes + statistics.failed_bytes, 2 * locked.size() * sizeof(int32_t))) << "pinned at allocation";
+        }
+        expect(eq(resource.lock_statistics().locked_bytes, 0UL)) << "unpinned on release";
+    };
+
+    "CircularBuffer - overflow policy"_test = [] {
+        using namespace gr;
+        const auto fill = [](int32_t &value) { return [&value](std::span<int32_t> &w) { std::iota(w.begin(), w.end(), value); value += static_cast<int32_t>(w.size()); }; };
+
+        "drop newest"_test = [&fill] {
+            circular_buffer<int32_t> buffer(1024, OverflowPolicy::DropNewest);
+            expect(buffer.overflow_policy() == OverflowPolicy::DropNewest);
+            BufferWriter auto writer = buffer.new_writer();
+            BufferReader auto reader = buffer.new_reader();
+            const std::size_t size   = buffer.size();
+            int32_t           value  = 0;
+            for (std::size_t i = 0; i < 4; i++) {
+                writer.publish(fill(value), size / 2); // N.B. must not block
+            }
+            expect(eq(writer.n_dropped(), size));
+            expect(eq(reader.available(), size));
+            expect(eq(reader.get().front(), 0)) << "buffer content is retained";
+            expect(eq(reader.get().back(), static_cast<int32_t>(size - 1)));
+            expect(reader.consume(size / 2));
+
+            auto dropped = writer.reserve_output_range(size);
+            expect(dropped.empty());
+            expect(eq(writer.n_dropped(), 2 * size));
+            const auto position = writer.position();
+            dropped[0]          = -1; // N.B. discarded, must not overwrite the retained samples
+            dropped.publish(size);
+            expect(eq(writer.position(), position)) << "publishing a dropped reservation is a no-op";
+            expect(eq(reader.available(), size / 2));
+            expect(eq(reader.get().front(), static_cast<int32_t>(size / 2)));
+            auto range = writer.reserve_output_range(size / 2);
+            expect(eq(range.size(), size / 2));
+            range.publish(size / 2);
+            expect(!writer.try_publish(fill(value), 1)) << "try_publish reports rather than drops";
+            expect(eq(writer.n_dropped(), 2 * size));
+        };
+
+        "drop oldest"_test = [&fill] {
+            circular_buffer<int32_t> buffer(1024, OverflowPolicy::DropOldest);
+            BufferWriter auto writer  = buffer.new_writer();
+            BufferReader auto reader  = buffer.new_reader();
+            BufferReader auto reader2 = buffer.new_reader();
+            const std::size_t size    = buffer.size();
+            expect(eq(writer.available(), size));
+            int32_t value = 0;
+            for (std::size_t i = 0; i < 5; i++) {
+                writer.publish(fill(value), size / 2); // N.B. must not block
+            }
+            expect(eq(writer.n_dropped(), 3 * size / 2));
+            expect(eq(reader.available(), size));
+            expect(eq(reader.get().front(), static_cast<int32_t>(3 * size / 2))) << "oldest samples are overwritten";
+            expect(eq(reader.n_dropped(), 3 * size / 2));
+            expect(reader.consume(size / 2));
+
+            // samples being overrun while being read
+            const auto data = reader2.get(size);
+            writer.publish(fill(value), size);
+            expect(reader2.consume(data.size()));
+            expect(eq(reader2.n_dropped(), 5 * size / 2));
+            expect(eq(reader2.get().front(), static_cast<int32_t>(5 * size / 2)));
+            expect(eq(reader.get().front(), static_cast<int32_t>(5 * size / 2)));
+
+            // no overflow -> nothing dropped
+            expect(reader.consume(size));
+            expect(reader2.consume(size));
+            const std::size_t n_dropped = writer.n_dropped();
+            writer.publish(fill(value), size);
+            expect(eq(writer.n_dropped(), n_dropped));
+        };
+
+        "drop oldest requires a single producer"_test = [] {
+            expect(circular_buffer<int32_t, std::dynamic_extent, ProducerType::Single>::supports_overflow_policy(OverflowPolicy::DropOldest));
+            expect(!circular_buffer<int32_t, std::dynamic_extent, ProducerType::Multi>::supports_overflow_policy(OverflowPolicy::DropOldest));
+            expect(circular_buffer<int32_t, std::dynamic_extent, ProducerType::Multi>::supports_overflow_policy(OverflowPolicy::DropNewest));
+            expect(throws<std::invalid_argument>([] { std::ignore = circular_buffer<int32_t, std::dynamic_extent, ProducerType::Multi>(1024, OverflowPolicy::DropOldest); }));
+            expect(throws<std::invalid_argument>([] { std::ignore = circular_buffer<int32_t, std::dynamic_extent, ProducerType::MultiBatched>(1024, OverflowPolicy::DropOldest); }));
+            expect(nothrow([] { std::ignore = circular_buffer<int32_t, std::dynamic_extent, ProducerType::Multi>(1024, OverflowPolicy::DropNewest); }));
+        };
+    };
 };
 
+#ifdef HAS_SHARED_MEMORY_INTERFACE
+const boost::ut::suite SharedCircularBufferTests = [] {
+    using namespace boost::ut;
+    using namespace gr;
+
+    "SharedCircularBuffer"_test = [] {
+        shared_circular_buffer<int32_t> buffer(1000, "qa_shared_buffer");
+        expect(Buffer<decltype(buffer)>);
+        expect(ge(buffer.size(), 1000UL));
+        expect(std::has_single_bit(buffer.size()));
+
+        // emulate the remote process: second, independent mapping of the same memfd passed through a Unix domain socket
+        int sockets[2];
+        expect(eq(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets), 0));
+        shm::send_fd(sockets[0], buffer.native_handle());
+        auto remote = shared_circular_buffer<int32_t>::attach(shm::receive_fd(sockets[1]));
+        ::close(sockets[0]);
+        ::close(sockets[1]);
+        expect(eq(remote.size(), buffer.size()));
+        expect(neq(remote.native_handle(), buffer.native_handle()));
+        expect(throws([&] { std::ignore = shared_circular_buffer<double>::attach(::dup(buffer.native_handle())); })) << "element type mismatch";
+
+        BufferReader auto reader = remote.new_reader();
+        expect(eq(buffer.n_readers(), 1UL));
+        {
+            BufferWriter auto writer = buffer.new_writer();
+            expect(throws([&] { std::ignore = remote.new_writer(); })) << "single writer across processes";
+            expect(eq(writer.available(), buffer.size()));
+
+            // wrap around several times, data is contiguous thanks to the double-mapping
+            int32_t offset = 0;
+            for (std::size_t i = 0; i < 5; i++) {
+                writer.publish([&offset](std::span<int32_t> &w) { std::iota(w.begin(), w.end(), offset); offset += static_cast<int32_t>(w.size()); }, 600);
+                expect(eq(reader.available(), 600UL));
+                const auto data = reader.get();
+                expect(eq(data.front(), offset - 600));
+                expect(eq(data.back(), offset - 1));
+                expect(reader.consume(data.size()));
+            }
+
+            auto range = writer.reserve_output_range(10);
+            std::iota(range.begin(), range.end(), 0);
+            range.publish(10);
+            expect(eq(reader.get()[9], 9));
+            expect(not reader.end_of_stream());
+            expect(reader.consume(10));
+        }
+        expect(remote.is_closed());
+        expect(reader.end_of_stream());
+    };
+};
+#endif
+
 const boost::ut::suite CircularBufferExceptionTests = [] {
     using namespace boost::ut;
     "CircularBufferExceptions"_test = [] {
@@ -577,6 +1207,24 @@ const boost::ut::suite HistoryBufferTest = [] {
         expect(equal(std::vector(hb.crbegin(), hb.crend()), std::vector(hb.rbegin(), hb.rend()))) << "const non-const iterator equivalency";
     };
 
+    "history_buffer - bulk vs. single push_back"_test = [](const std::size_t &capacity) {
+        history_buffer<int> hb_bulk(capacity);
+        history_buffer<int> hb_single(capacity);
+        int                 value = 0;
+        for (const std::size_t n_elements : std::vector<std::size_t>{ 1, 2, capacity - 1, capacity, capacity + 1, 3, 2 * capacity + 3 }) {
+            std::vector<int> chunk(n_elements);
+            std::iota(chunk.begin(), chunk.end(), value);
+            value += static_cast<int>(n_elements);
+            hb_bulk.push_back_bulk(chunk);
+            std::ranges::for_each(chunk, [&hb_single](int v) { hb_single.push_back(v); });
+
+            expect(eq(hb_bulk.size(), hb_single.size()));
+            expect(std::ranges::equal(hb_bulk.get_span(0), hb_single.get_span(0))) << fmt::format("capacity {} chunk {}: [{}] vs. [{}]", capacity, n_elements, fmt::join(hb_bulk.get_span(0), ", "), fmt::join(hb_single.get_span(0), ", "));
+            expect(std::ranges::equal(std::vector(hb_bulk.rbegin(), hb_bulk.rend()), std::vector(hb_single.rbegin(), hb_single.rend())));
+            expect(eq(hb_bulk[0], value - 1));
+        }
+    } | std::vector<std::size_t>{ 5, 8, 32 };
+
     "history_buffer<T> edge cases"_test = [] {
         fmt::print("\n\ntesting edge cases:\n");
         expect(throws<std::out_of_range>([] { history_buffer<int>(0); })) << "throws for 0 capacity";
@@ -135,6 +135,219 @@ const boost::ut::suite PortApiTests = [] {
         expect(writer.try_publish(lambda, 32_UZ));
     };
 
+    "LazyPortBuffers"_test = [] {
+        OUT<float, 0, std::numeric_limits<std::size_t>::max(), "out0"> output_port;
+        IN<float, 0, std::numeric_limits<std::size_t>::max(), "in0">   input_port1;
+        IN<float, 0, std::numeric_limits<std::size_t>::max(), "in1">   input_port2;
+        expect(not output_port.is_connected());
+        expect(not input_port1.is_connected());
+
+        // unconnected inputs read from their own (not shared) never written-to buffer
+        expect(eq(input_port1.streamReader().available(), 0_UZ));
+        expect(eq(input_port1.tagReader().available(), 0_UZ));
+        expect(eq(input_port2.streamReader().available(), 0_UZ));
+        expect(eq(input_port1.buffer().streamBuffer.n_readers(), 1_UZ));
+        expect(eq(input_port2.buffer().streamBuffer.n_readers(), 1_UZ));
+
+        // unconnected outputs write into a small null buffer w/o readers, their tags are dropped
+        auto &null_writer = output_port.streamWriter();
+        expect(eq(null_writer.buffer().size(), output_port.null_buffer_size));
+        expect(lt(output_port.null_buffer_size, output_port.default_buffer_size));
+        const auto position = null_writer.position();
+        auto       samples  = null_writer.reserve_output_range(null_writer.available());
+        samples.publish(samples.size());
+        expect(eq(null_writer.position(), position + static_cast<std::make_signed_t<std::size_t>>(output_port.null_buffer_size)));
+        publish_tag(output_port, { { "key", 42.f } });
+        expect(not output_port.is_connected());
+
+        expect(eq(output_port.connect(input_port1), connection_result_t::SUCCESS));
+        expect(output_port.is_connected());
+        expect(input_port1.is_connected());
+        expect(ge(output_port.streamWriter().buffer().size(), output_port.default_buffer_size)) << "buffers are created on connect";
+        expect(eq(input_port1.tagReader().available(), 0_UZ));
+        publish_tag(output_port, { { "key", 42.f } });
+        expect(eq(input_port1.tagReader().available(), 1_UZ));
+
+        expect(eq(input_port1.disconnect(), connection_result_t::SUCCESS));
+        expect(not input_port1.is_connected());
+        expect(eq(input_port1.streamReader().available(), 0_UZ));
+    };
+
+    "BufferSizeVsMinSamples"_test = [] {
+        constexpr std::size_t                                                    min_samples = 2 * OUT<float>::default_buffer_size;
+        OUT<float, min_samples, std::numeric_limits<std::size_t>::max(), "out0"> large_output;
+        OUT<float, 0, std::numeric_limits<std::size_t>::max(), "out1">           default_output;
+        IN<float, 0, std::numeric_limits<std::size_t>::max(), "in0">             input_port;
+        IN<float, min_samples, std::numeric_limits<std::size_t>::max(), "in1">   large_input;
+
+        // the output buffer holds at least the port's minimum number of samples, also when resized below it
+        expect(eq(large_output.connect(input_port), connection_result_t::SUCCESS));
+        expect(ge(large_output.streamWriter().buffer().size(), min_samples));
+        expect(eq(large_output.resize_buffer(1024), connection_result_t::SUCCESS));
+        expect(ge(large_output.streamWriter().buffer().size(), min_samples));
+
+        // inputs whose minimum exceeds the upstream buffer would never become ready -> rejected
+        expect(eq(default_output.connect(large_input), connection_result_t::FAILED));
+        expect(not large_input.is_connected());
+        expect(not default_output.is_connected()) << "failed connect must not leave the output writing into a reader-less buffer";
+        expect(lt(default_output.streamWriter().buffer().size(), OUT<float>::default_buffer_size)) << "null handler";
+    };
+
+    "CompactTagBuffer"_test = [] {
+        using tag_buffer = gr::circular_buffer<compact_tag_t>;
+        port<float, "out0", port_type_t::STREAM, port_direction_t::OUTPUT, 0, std::numeric_limits<std::size_t>::max(), gr::circular_buffer<float>, tag_buffer> output_port;
+        port<float, "in0", port_type_t::STREAM, port_direction_t::INPUT, 0, std::numeric_limits<std::size_t>::max(), gr::circular_buffer<float>, tag_buffer>   input_port1;
+        port<float, "in1", port_type_t::STREAM, port_direction_t::INPUT, 0, std::numeric_limits<std::size_t>::max(), gr::circular_buffer<float>, tag_buffer>   input_port2;
+        expect(eq(output_port.connect(input_port1), connection_result_t::SUCCESS));
+        expect(eq(output_port.connect(input_port2), connection_result_t::SUCCESS));
+
+        publish_tag(output_port, { { "key", 42.f } }, 3);
+        const auto tags1 = input_port1.tagReader().get(1);
+        const auto tags2 = input_port2.tagReader().get(1);
+        expect(eq(tags1.size(), 1_UZ) and eq(tags2.size(), 1_UZ));
+        expect(eq(tags1[0].index, 2L));
+        expect(eq(std::get<float>(tags1[0].at("key")), 42.f));
+        expect(tags1[0].payload.get() == tags2[0].payload.get()) << "fan-out readers share one payload";
+    };
+
+    "NonBlockingConnection"_test = [] {
+        OUT<float, 0, std::numeric_limits<std::size_t>::max(), "out0"> output_port;
+        IN<float, 0, std::numeric_limits<std::size_t>::max(), "in0">   monitor;
+        expect(eq(output_port.connect(monitor, connection_mode_t::NON_BLOCKING), connection_result_t::SUCCESS));
+        expect(monitor.is_connected());
+
+        auto buffers = output_port.buffer();
+        expect(eq(buffers.streamBuffer.n_readers(), 0_UZ)) << "monitor does not gate the writer";
+        expect(eq(buffers.streamBuffer.n_monitor_readers(), 1_UZ));
+        expect(eq(monitor.streamReader().mode(), gr::ReaderMode::Monitor));
+
+        // publish more than the buffer size without a consumer -> must not block
+        BufferWriter auto &writer = output_port.streamWriter();
+        const std::size_t  size   = buffers.streamBuffer.size();
+        float              value  = 0.f;
+        for (std::size_t i = 0; i < 4; i++) {
+            writer.publish([&value](std::span<float> &w) { std::iota(w.begin(), w.end(), value); value += static_cast<float>(w.size()); }, size / 2);
+        }
+        const auto data = monitor.streamReader().get();
+        expect(eq(data.size(), size / 2)) << "monitor skipped to the latest data";
+        expect(eq(data.back(), value - 1.f));
+        expect(eq(monitor.streamReader().n_dropped(), size + size / 2));
+        expect(monitor.streamReader().consume(data.size()));
+    };
+
+    "OverflowPolicy"_test = [] {
+        OUT<float, 0, std::numeric_limits<std::size_t>::max(), "out0"> output_port;
+        IN<float, 0, std::numeric_limits<std::size_t>::max(), "in0">   input_port;
+        expect(output_port.overflow_policy() == gr::OverflowPolicy::Block);
+        expect(eq(output_port.set_overflow_policy(gr::OverflowPolicy::DropNewest), connection_result_t::SUCCESS));
+        expect(eq(output_port.connect(input_port), connection_result_t::SUCCESS));
+        expect(eq(output_port.set_overflow_policy(gr::OverflowPolicy::Block), connection_result_t::FAILED)) << "policy needs to be set before connecting";
+
+        auto buffers = output_port.buffer();
+        expect(buffers.streamBuffer.overflow_policy() == gr::OverflowPolicy::DropNewest);
+        expect(buffers.tagBufferType.overflow_policy() == gr::OverflowPolicy::DropOldest);
+
+        // publish more than the buffer size without a consumer -> must not block
+        const std::size_t size = buffers.streamBuffer.size();
+        expect(eq(output_port.discard_span(size).size(), size));
+        expect(output_port.discard_span(1).data() == output_port.discard_span(size).data()) << "scratch memory is reserved on connect";
+        for (std::size_t i = 0; i < 3; i++) {
+            output_port.streamWriter().publish([](std::span<float> &w) { std::ranges::fill(w, 1.f); }, size / 2);
+        }
+        expect(eq(publish_overflow_tag(output_port), size / 2));
+        expect(eq(publish_overflow_tag(output_port), 0_UZ)) << "dropped samples are announced only once";
+
+        const auto tags = input_port.tagReader().get();
+        expect(eq(tags.size(), 1_UZ));
+        expect(eq(tags[0].index, output_port.streamWriter().position())) << "tag is attached to the next sample written";
+        expect(eq(std::get<uint64_t>(tags[0].at(tag::N_DROPPED)), static_cast<uint64_t>(size / 2)));
+
+        using multi_producer_buffer = gr::circular_buffer<float, std::dynamic_extent, gr::ProducerType::Multi>;
+        port<float, "out1", port_type_t::STREAM, port_direction_t::OUTPUT, std::dynamic_extent, std::dynamic_extent, multi_producer_buffer> multi_producer_port;
+        expect(eq(multi_producer_port.set_overflow_policy(gr::OverflowPolicy::DropOldest), connection_result_t::FAILED)) << "drop-oldest requires a single producer";
+        expect(eq(multi_producer_port.set_overflow_policy(gr::OverflowPolicy::DropNewest), connection_result_t::SUCCESS));
+    };
+
+    "InputHistory"_test = [] {
+        OUT<float, 0, std::numeric_limits<std::size_t>::max(), "out0"> output_port;
+        IN<float, 0, std::numeric_limits<std::size_t>::max(), "in0">   input_port;
+        expect(eq(input_port.history_size(), 0_UZ));
+        expect(eq(input_port.set_history_size(4), connection_result_t::SUCCESS));
+        expect(eq(output_port.connect(input_port), connection_result_t::SUCCESS));
+        expect(eq(input_port.set_history_size(8), connection_result_t::FAILED)) << "look-back needs to be set before connecting";
+        expect(eq(input_port.streamReader().n_history(), 4_UZ));
+
+        const std::size_t size = output_port.buffer().streamBuffer.size();
+        expect(eq(output_port.streamWriter().available(), size - 4)) << "writer is gated on the reader's position - history";
+        float value = 1.f;
+        output_port.streamWriter().publish([&value](std::span<float> &w) { std::ranges::for_each(w, [&value](float &v) { v = value++; }); }, 10);
+        expect(input_port.streamReader().consume(6));
+        const auto data = input_port.streamReader().get_history();
+        expect(eq(data.size(), 8_UZ)) << "4 history + 4 new samples";
+        expect(eq(data[0], 3.f) and eq(data[3], 6.f) and eq(data[4], 7.f) and eq(data[7], 10.f));
+
+        // the look-back (plus window) needs to fit into the buffer, otherwise the writer would never get space
+        expect(eq(input_port.set_window(size - 4, 1), connection_result_t::SUCCESS));
+        expect(eq(input_port.set_window(size - 3, 1), connection_result_t::FAILED)) << "window and look-back exceed the buffer";
+        IN<float, 0, std::numeric_limits<std::size_t>::max(), "in1"> large_history;
+        expect(eq(large_history.set_history_size(size), connection_result_t::SUCCESS)) << "not yet connected";
+        expect(eq(output_port.connect(large_history), connection_result_t::FAILED));
+        expect(not large_history.is_connected());
+
+        // ... and to be contiguous, i.e. not to run past the end of a two-span buffer's unmirrored storage
+        OUT<float, 0, std::numeric_limits<std::size_t>::max(), "out1"> split_output;
+        split_output.setBuffer(gr::circular_buffer<float>(1024, std::pmr::polymorphic_allocator<float>(), gr::WrapMode::Split), gr::circular_buffer<tag_t>(1024));
+        IN<float, 0, std::numeric_limits<std::size_t>::max(), "in2"> split_history;
+        expect(eq(split_history.set_history_size(4), connection_result_t::SUCCESS));
+        expect(eq(split_output.connect(split_history), connection_result_t::FAILED)) << "two-span buffers would cut the look-back at the wrap-around point";
+        expect(not split_history.is_connected());
+    };
+
+    "InputWindow"_test = [] {
+        IN<float, 0, std::numeric_limits<std::size_t>::max(), "in0"> input_port;
+        expect(eq(input_port.window_size(), 1_UZ));
+        expect(eq(input_port.hop_size(), 1_UZ));
+        expect(eq(input_port.set_window(8, 0), connection_result_t::FAILED)) << "hop needs to be > 0";
+        expect(eq(input_port.set_window(4, 8), connection_result_t::FAILED)) << "hop must not exceed the window";
+        expect(eq(input_port.set_window(8, 2), connection_result_t::SUCCESS));
+        expect(eq(input_port.window_size(), 8_UZ));
+        expect(eq(input_port.hop_size(), 2_UZ));
+
+        // windows need to fit (contiguously) into the connected buffer
+        OUT<float, 0, std::numeric_limits<std::size_t>::max(), "out0"> output_port;
+        expect(eq(output_port.connect(input_port), connection_result_t::SUCCESS));
+        const std::size_t size = output_port.buffer().streamBuffer.size();
+        expect(eq(input_port.set_window(size + 1, 2), connection_result_t::FAILED)) << "window exceeds the buffer";
+        expect(eq(input_port.window_size(), 8_UZ));
+        IN<float, 0, std::numeric_limits<std::size_t>::max(), "in1"> large_window;
+        expect(eq(large_window.set_window(size + 1, 2), connection_result_t::SUCCESS)) << "not yet connected";
+        expect(eq(output_port.connect(large_window), connection_result_t::FAILED));
+        expect(not large_window.is_connected());
+
+        IN<float, 0, std::numeric_limits<std::size_t>::max(), "in2"> split_input;
+        split_input.setBuffer(gr::circular_buffer<float>(1024, std::pmr::polymorphic_allocator<float>(), gr::WrapMode::Split), gr::circular_buffer<tag_t>(1024));
+        expect(eq(split_input.set_window(8, 2), connection_result_t::FAILED)) << "two-span buffers would cut windows at the wrap-around point";
+        expect(eq(split_input.set_window(1, 1), connection_result_t::SUCCESS));
+
+        // windows crossing the buffer's wrap-around point are contiguous and keep their overlap
+        auto  &writer = output_port.streamWriter();
+        auto  &reader = input_port.streamReader();
+        float  value  = 0.f;
+        const auto fill = [&value](std::span<float> &w) { std::ranges::for_each(w, [&value](float &v) { v = value++; }); };
+        writer.publish(fill, size - 2);
+        expect(reader.consume(size - 6));
+        writer.publish(fill, 8);
+        const std::size_t n_window = 2 * input_port.hop_size() + input_port.window_size() - input_port.hop_size(); // two hops
+        const auto        data     = reader.get(n_window);
+        expect(eq(data.size(), n_window));
+        for (std::size_t i = 0; i < n_window; i++) {
+            expect(eq(data[i], static_cast<float>(size - 6 + i))) << "sample" << i;
+        }
+        expect(reader.consume(2 * input_port.hop_size()));
+        const auto next = reader.get(input_port.window_size());
+        expect(eq(next.front(), data[2 * input_port.hop_size()])) << "consecutive windows overlap by 'window - hop' samples";
+    };
+
     "RuntimePortApi"_test = [] {
         // declare in block
         OUT<float, 0, std::numeric_limits<std::size_t>::max(), "out"> out;
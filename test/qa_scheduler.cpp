@@ -1,5 +1,7 @@
 #include <boost/ut.hpp>
 
+#include <numeric>
+
 #include <scheduler.hpp>
 
 #if defined(__clang__) && __clang_major__ >= 16
@@ -97,6 +99,50 @@ public:
     }
 };
 
+template<typename T, std::size_t Window, std::size_t Hop>
+class window_sum : public fg::node<window_sum<T, Window, Hop>, fg::IN<T, 0, std::numeric_limits<std::size_t>::max(), "in">, fg::OUT<T, 0, std::numeric_limits<std::size_t>::max(), "out">> {
+    trace_vector &tracer;
+
+public:
+    window_sum(trace_vector &trace, std::string_view name) : tracer{ trace } {
+        this->_name = name;
+        std::ignore = fg::input_port<"in">(this).set_window(Window, Hop);
+    }
+
+    [[nodiscard]] fg::work_return_t
+    process_bulk(std::span<const T> input, std::span<T> output) noexcept {
+        trace(tracer, this->name());
+        boost::ut::expect(boost::ut::that % input.size() == output.size() + Window - Hop);
+        // one sum per window, repeated for each output sample of its hop
+        for (std::size_t i = 0; i < output.size(); i += Hop) {
+            const auto window = input.subspan(i, Window);
+            std::fill_n(output.begin() + static_cast<std::ptrdiff_t>(i), Hop, std::accumulate(window.begin(), window.end(), T{ 0 }));
+        }
+        return fg::work_return_t::OK;
+    }
+};
+
+template<typename T, std::size_t N, std::size_t M>
+class resampler : public fg::node<resampler<T, N, M>, fg::IN<T, 0, std::numeric_limits<std::size_t>::max(), "in">, fg::OUT<T, 0, std::numeric_limits<std::size_t>::max(), "out">,
+                                  fg::ResamplingRatio<N, M>> {
+    trace_vector &tracer;
+
+public:
+    resampler(trace_vector &trace, std::string_view name) : tracer{ trace } { this->_name = name; }
+
+    [[nodiscard]] fg::work_return_t
+    process_bulk(std::span<const T> input, std::span<T> output) noexcept {
+        trace(tracer, this->name());
+        boost::ut::expect(boost::ut::that % input.size() % N == 0u);
+        boost::ut::expect(boost::ut::that % output.size() == input.size() / N * M);
+        // zero-order hold: the first sample of each input chunk is repeated for its output chunk
+        for (std::size_t i = 0; i < input.size() / N; ++i) {
+            std::fill_n(output.begin() + static_cast<std::ptrdiff_t>(i * M), M, input[i * N]);
+        }
+        return fg::work_return_t::OK;
+    }
+};
+
 fair::graph::graph
 get_graph_linear(trace_vector &traceVector) {
     using fg::port_direction_t::INPUT;
@@ -256,6 +302,159 @@ const boost::ut::suite SchedulerTests = [] {
         expect(boost::ut::that % t.size() == 10u);
         expect(boost::ut::that % t == trace_vector{ "s1", "s2", "mult", "add", "out", "s1", "s2", "mult", "add", "out" });
     };
+
+    "SimpleScheduler_overlapping_windows"_test = [] {
+        using scheduler                  = fair::graph::scheduler::simple;
+        constexpr std::size_t window     = 8;
+        constexpr std::size_t hop        = 2;
+        constexpr std::size_t n_samples  = 100000;
+        std::size_t           n_received = 0;
+        trace_vector          t{};
+
+        fg::graph             flow;
+        auto                 &source = flow.make_node<count_source<int, n_samples>>(t, "s1");
+        auto                 &sums   = flow.make_node<window_sum<int, window, hop>>(t, "sum");
+        auto                 &sink   = flow.make_node<expect_sink<int>>(t, "out", [&n_received](std::int64_t count, std::int64_t data) {
+            // the window belonging to sample 'count' starts at the beginning of its hop
+            constexpr auto w     = static_cast<std::int64_t>(window);
+            const auto     start = count / static_cast<std::int64_t>(hop) * static_cast<std::int64_t>(hop);
+            expect(boost::ut::that % data == w * start + w * (w - 1) / 2);
+            n_received++;
+        });
+        expect(eq(flow.connect<"out">(source).to<"in">(sums), fg::connection_result_t::SUCCESS));
+        expect(eq(flow.connect<"out">(sums).to<"in">(sink), fg::connection_result_t::SUCCESS));
+
+        auto sched = scheduler{ std::move(flow) };
+        sched.work();
+        expect(eq(n_received, (n_samples - window) / hop * hop + hop)) << "only complete windows are processed";
+    };
+
+    "BreadthFirstScheduler_resampling_ratio"_test = [] {
+        using scheduler                  = fair::graph::scheduler::breadth_first;
+        constexpr std::size_t n_samples  = 100003; // N.B. not a multiple of the decimation
+        std::size_t           n_received = 0;
+        trace_vector          t{};
+
+        fg::graph             flow;
+        auto                 &source     = flow.make_node<count_source<int, n_samples>>(t, "s1");
+        auto                 &decimate   = flow.make_node<resampler<int, 4, 1>>(t, "decimate");
+        auto                 &interp     = flow.make_node<resampler<int, 1, 3>>(t, "interpolate");
+        auto                 &sink       = flow.make_node<expect_sink<int>>(t, "out", [&n_received](std::int64_t count, std::int64_t data) {
+            expect(boost::ut::that % data == count / 3 * 4);
+            n_received++;
+        });
+        expect(eq(flow.connect<"out">(source).to<"in">(decimate), fg::connection_result_t::SUCCESS));
+        expect(eq(flow.connect<"out">(decimate).to<"in">(interp), fg::connection_result_t::SUCCESS));
+        expect(eq(flow.connect<"out">(interp).to<"in">(sink), fg::connection_result_t::SUCCESS));
+
+        auto sched = scheduler{ std::move(flow) };
+        expect(sched.graph().blocks()[1]->resampling_ratio() == std::pair<std::size_t, std::size_t>{ 4, 1 });
+        sched.work();
+        expect(eq(n_received, n_samples / 4 * 3)) << "only whole input chunks are processed";
+    };
+
+    "SimpleScheduler_simd_misaligned_chunks"_test = [] {
+        using scheduler                  = fair::graph::scheduler::simple;
+        constexpr std::size_t n_samples  = 100003;
+        std::size_t           n_received = 0;
+        trace_vector          t{};
+
+        // the 3:3 node processes multiples of three samples, i.e. shifts the stream positions off the SIMD alignment
+        fg::graph             flow;
+        auto                 &source = flow.make_node<count_source<int, n_samples>>(t, "s1");
+        auto                 &chunks = flow.make_node<resampler<int, 3, 3>>(t, "chunks");
+        auto                 &mult   = flow.make_node<scale<int, 2>>(t, "mult");
+        auto                 &sink   = flow.make_node<expect_sink<int>>(t, "out", [&n_received](std::int64_t count, std::int64_t data) {
+            expect(boost::ut::that % data == 2 * (count / 3 * 3)) << "masked prologue/epilogue and aligned main loop";
+            n_received++;
+        });
+        expect(eq(flow.connect<"out">(source).to<"in">(chunks), fg::connection_result_t::SUCCESS));
+        expect(eq(flow.connect<"out">(chunks).to<"original">(mult), fg::connection_result_t::SUCCESS));
+        expect(eq(flow.connect<"scaled">(mult).to<"in">(sink), fg::connection_result_t::SUCCESS));
+
+        auto sched = scheduler{ std::move(flow) };
+        sched.work();
+        expect(eq(n_received, n_samples / 3 * 3));
+    };
+
+    "SimpleScheduler_online_buffer_resize"_test = [] {
+        using scheduler                  = fair::graph::scheduler::simple;
+        constexpr std::size_t n_samples  = 200000;
+        std::size_t           n_received = 0;
+        trace_vector          t{};
+
+        fg::graph             flow;
+        auto                 &source = flow.make_node<count_source<int, n_samples>>(t, "s1");
+        auto                 &sink   = flow.make_node<expect_sink<int>>(t, "out", [&n_received](std::int64_t count, std::int64_t data) {
+            expect(boost::ut::that % data == count) << "no samples lost or reordered";
+            n_received++;
+        });
+        expect(eq(flow.connect<"out">(source).to<"in">(sink), fg::connection_result_t::SUCCESS));
+
+        auto sched = scheduler{ std::move(flow) };
+        // pause after the source filled (part of) its buffer, i.e. with unconsumed samples in flight
+        expect(sched.graph().blocks()[0]->work() == fg::work_return_t::OK);
+        expect(eq(sched.graph().resize_buffer(source, 0, 1024), fg::connection_result_t::FAILED)) << "in-flight samples exceed the new size";
+        expect(eq(sched.graph().resize_buffer(source, 0, 4 * 65536), fg::connection_result_t::SUCCESS));
+        expect(eq(sched.graph().resize_buffer(source, 1, 1024), fg::connection_result_t::FAILED)) << "no such output port";
+
+        sched.work();
+        expect(eq(n_received, n_samples));
+    };
+
+    "SimpleScheduler_drop_newest_overflow"_test = [] {
+        using scheduler                  = fair::graph::scheduler::simple;
+        constexpr std::size_t n_samples  = 4 * 65536;
+        std::size_t           n_received = 0;
+        std::int64_t          last       = -1;
+        trace_vector          t{};
+
+        fg::graph             flow;
+        auto                 &source = flow.make_node<count_source<int, n_samples>>(t, "s1");
+        auto                 &sink   = flow.make_node<expect_sink<int>>(t, "out", [&n_received, &last](std::int64_t count, std::int64_t data) {
+            expect(boost::ut::that % data >= count) << "dropped samples are skipped";
+            expect(boost::ut::that % data > last) << "retained samples are neither duplicated nor reordered";
+            last = data;
+            n_received++;
+        });
+        auto &out = fg::output_port<"out">(&source);
+        expect(eq(out.set_overflow_policy(gr::OverflowPolicy::DropNewest), fg::connection_result_t::SUCCESS));
+        expect(eq(flow.connect<"out">(source).to<"in">(sink), fg::connection_result_t::SUCCESS));
+
+        auto              sched  = scheduler{ std::move(flow) };
+        auto             &reader = fg::input_port<"in">(&sink).streamReader();
+        const std::size_t size   = out.streamWriter().buffer().size();
+        expect(source.work() == fg::work_return_t::OK);
+        expect(eq(out.streamWriter().n_dropped(), 0UL));
+        // full buffer: the source neither waits nor stalls but produces (and drops) a single sample
+        expect(source.work() == fg::work_return_t::OK);
+        expect(eq(out.streamWriter().n_dropped(), 1UL));
+        expect(eq(out.streamWriter().position() + 1, static_cast<std::make_signed_t<std::size_t>>(size))) << "dropped sample was not published";
+
+        // reader partly behind: the freed space is filled, nothing is dropped
+        const std::size_t n_skipped = 3 * size / 4;
+        expect(reader.consume(n_skipped));
+        expect(source.work() == fg::work_return_t::OK);
+        expect(eq(out.streamWriter().n_dropped(), 1UL));
+        expect(eq(out.streamWriter().position() + 1, static_cast<std::make_signed_t<std::size_t>>(size + n_skipped)));
+        expect(eq(reader.available(), size));
+
+        sched.work();
+        expect(gt(n_received, 0UL));
+        expect(eq(n_received + n_skipped + out.streamWriter().n_dropped(), n_samples)) << "every sample is either received, skipped or dropped";
+    };
+
+    "SimpleScheduler_locked_edge_memory"_test = [] {
+        using scheduler = fair::graph::scheduler::simple;
+        trace_vector t{};
+        auto         sched  = scheduler{ get_graph_linear(t) };
+        // N.B. pinning may fail depending on 'RLIMIT_MEMLOCK' (see 'ulimit -l'), the memory is prefaulted either way
+        const auto   result = sched.graph().lock_all_edge_memory();
+        expect(gt(result.locked_bytes + result.failed_bytes, 0UL));
+        expect(eq(result.ok(), result.n_failures == 0));
+        sched.work();
+        expect(boost::ut::that % t.size() == 8u);
+    };
 };
 
 int
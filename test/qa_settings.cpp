@@ -176,8 +176,62 @@ struct Sink : public node<Sink<T>> {
         }
     }
 };
+
+template<typename T>
+struct TagSource : public node<TagSource<T>> {
+    OUT<T>                                             out;
+    std::int32_t                                       n_samples_produced = 0;
+    std::int32_t                                       n_samples_max      = 1024;
+    std::vector<std::pair<std::int32_t, property_map>> tags; // (sample index, tag map)
+
+    constexpr std::make_signed_t<std::size_t>
+    available_samples(const TagSource &self) noexcept {
+        const auto ret = static_cast<std::make_signed_t<std::size_t>>(n_samples_max - n_samples_produced);
+        return ret > 0 ? ret : -1; // '-1' -> DONE, produced enough samples
+    }
+
+    [[nodiscard]] constexpr work_return_t
+    process_bulk(std::span<T> output) noexcept {
+        const auto n_output = static_cast<std::int32_t>(output.size());
+        for (const auto &[index, map] : tags) {
+            if (index >= n_samples_produced && index < n_samples_produced + n_output) {
+                publish_tag(out, map, static_cast<std::size_t>(index - n_samples_produced));
+            }
+        }
+        std::fill(output.begin(), output.end(), T(1));
+        n_samples_produced += n_output;
+        return work_return_t::OK;
+    }
+};
+
+template<typename T>
+struct BatchedScale : public node<BatchedScale<T>, BatchedTags> {
+    IN<T>                    in;
+    OUT<T>                   out;
+    T                        scaling_factor = T(1);
+    std::size_t              n_calls        = 0;
+    std::size_t              n_processed    = 0;
+    std::vector<std::size_t> tag_positions; // absolute sample positions of the received tags
+    T                        output_sum = T(0);
+
+    [[nodiscard]] constexpr work_return_t
+    process_bulk(std::span<const T> input, std::span<T> output) noexcept {
+        n_calls++;
+        for (const relative_tag_t &tag : this->input_tag_batch()) {
+            tag_positions.push_back(n_processed + tag.index);
+        }
+        for (std::size_t i = 0; i < input.size(); i++) {
+            output[i] = scaling_factor * input[i];
+            output_sum += output[i];
+        }
+        n_processed += input.size();
+        return work_return_t::OK;
+    }
+};
 } // namespace fair::graph::setting_test
 
+ENABLE_REFLECTION_FOR_TEMPLATE_FULL((typename T), (fair::graph::setting_test::TagSource<T>), out, n_samples_produced, n_samples_max);
+ENABLE_REFLECTION_FOR_TEMPLATE_FULL((typename T), (fair::graph::setting_test::BatchedScale<T>), in, out, scaling_factor);
 ENABLE_REFLECTION_FOR_TEMPLATE_FULL((typename T), (fair::graph::setting_test::Source<T>), out, n_samples_produced, n_samples_max, n_tag_offset, sample_rate);
 ENABLE_REFLECTION_FOR_TEMPLATE_FULL((typename T), (fair::graph::setting_test::TestBlock<T>), in, out, scaling_factor, context, n_samples_max, sample_rate, vector_setting);
 ENABLE_REFLECTION_FOR_TEMPLATE_FULL((typename T), (fair::graph::setting_test::Sink<T>), in, n_samples_consumed, n_samples_max, last_tag_position, sample_rate);
@@ -261,6 +315,121 @@ const boost::ut::suite SettingsTests = [] {
         expect(sink.settings().auto_update_parameters().contains("sample_rate")) << "sink retained auto-update flag";
     };
 
+    "settings dispatch table"_test = [] {
+        using dispatch = fair::graph::detail::settings_dispatch<TestBlock<float>>;
+        static_assert(dispatch::fields().size() == 5UL, "scaling_factor, context, n_samples_max, sample_rate, vector_setting");
+        static_assert(std::ranges::is_sorted(dispatch::fields(), {}, &dispatch::field::name));
+        static_assert(dispatch::find("sample_rate") != nullptr);
+        static_assert(dispatch::find("in") == nullptr, "ports are not settings");
+        static_assert(dispatch::find("unknown") == nullptr);
+
+        graph             flow_graph;
+        TestBlock<float> &block = flow_graph.make_node<TestBlock<float>>();
+        const auto       *field = dispatch::find("scaling_factor");
+        expect(field->holds_type(pmtv::pmt(2.f)));
+        expect(not field->holds_type(pmtv::pmt(2.0))) << "no implicit type conversions";
+        field->assign(block, pmtv::pmt(2.f));
+        expect(eq(block.scaling_factor.value, 2.f));
+
+        expect(eq(block.settings().set({ { "sample_rate", 1.0 } }).size(), 1UL)) << "type mismatch is not set";
+        expect(block.settings().set({ { "sample_rate", 1.0f }, { "vector_setting", std::vector<float>{ 1.f } } }).empty());
+        std::ignore = block.settings().apply_staged_parameters();
+        expect(eq(block.sample_rate, 1.0f));
+        expect(eq(block.vector_setting.size(), 1UL));
+    };
+
+    "batched tags"_test = [] {
+        graph flow_graph;
+        auto  &src   = flow_graph.make_node<TagSource<float>>({ { "n_samples_max", 1000 } });
+        src.tags     = { { 100, { { "scaling_factor", 2.f } } }, { 200, { { "annotation", std::string("no setting") } } }, { 300, { { "scaling_factor", 3.f } } } };
+        auto  &block = flow_graph.make_node<BatchedScale<float>>();
+        auto  &sink  = flow_graph.make_node<Sink<float>>();
+        expect(block.settings().auto_update_parameters().contains("scaling_factor"));
+
+        expect(eq(connection_result_t::SUCCESS, flow_graph.connect<"out">(src).to<"in">(block)));
+        expect(eq(connection_result_t::SUCCESS, flow_graph.connect<"out">(block).to<"in">(sink)));
+
+        fair::graph::scheduler::simple sched{ std::move(flow_graph) };
+        sched.work();
+        expect(eq(src.n_samples_produced, 1000));
+        expect(eq(sink.n_samples_consumed, 1000));
+        expect(eq(block.n_processed, 1000UL));
+        // the chunk is split only at the two setting changes, the annotation is handed over within the second call
+        expect(eq(block.n_calls, 3UL));
+        expect(block.tag_positions == std::vector<std::size_t>{ 100, 200, 300 });
+        // new settings apply exactly from the tagged sample onwards
+        expect(eq(block.scaling_factor, 3.f));
+        expect(eq(block.output_sum, 100.f * 1.f + 200.f * 2.f + 700.f * 3.f));
+    };
+
+    "context-multiplexed settings"_test = [] {
+        graph             flow_graph;
+        TestBlock<float> &block = flow_graph.make_node<TestBlock<float>>();
+        const SettingsCtx beam1{ .context = { tag::CONTEXT(std::string("BEAM1")) } };
+        const SettingsCtx beam2{ .context = { tag::CONTEXT(std::string("BEAM2")) } };
+
+        expect(eq(block.settings().set({ { "scaling_factor", 2.f }, { "unknown", 42 } }, beam1).size(), 1UL)) << "unknown keys are not stored";
+        expect(block.settings().set({ { "scaling_factor", 3.f }, { "sample_rate", 10.f } }, beam2).empty());
+        expect(not block.settings().changed()) << "context settings become active only once switched to";
+        expect(eq(block.scaling_factor.value, 1.f));
+        expect(eq(std::get<float>(block.settings().get("scaling_factor", beam1).value()), 2.f));
+        expect(eq(std::get<float>(block.settings().get("scaling_factor", beam2).value()), 3.f));
+        expect(not block.settings().get("sample_rate", beam1).has_value());
+
+        block.settings().auto_update({ tag::CONTEXT(std::string("BEAM2")) });
+        expect(block.settings().changed());
+        std::ignore = block.settings().apply_staged_parameters();
+        expect(eq(block.scaling_factor.value, 3.f));
+        expect(eq(block.sample_rate, 10.f));
+
+        // explicit values in the same tag take precedence over those of the context
+        block.settings().auto_update({ tag::CONTEXT(std::string("BEAM1")), { "sample_rate", 20.f } });
+        std::ignore = block.settings().apply_staged_parameters();
+        expect(eq(block.scaling_factor.value, 2.f));
+        expect(eq(block.sample_rate, 20.f)) << "not part of BEAM1";
+
+        block.settings().auto_update({ tag::CONTEXT(std::string("UNKNOWN")) });
+        std::ignore = block.settings().apply_staged_parameters();
+        expect(eq(block.scaling_factor.value, 2.f)) << "unknown contexts keep the current settings";
+
+        // pure context switches: the active settings reflect the contexts switched to in order
+        block.settings().auto_update({ tag::CONTEXT(std::string("BEAM2")) });
+        std::ignore = block.settings().apply_staged_parameters();
+        block.settings().auto_update({ tag::CONTEXT(std::string("BEAM1")) });
+        std::ignore = block.settings().apply_staged_parameters();
+        expect(eq(std::get<float>(block.settings().get("scaling_factor").value()), 2.f));
+        expect(eq(std::get<float>(block.settings().get("sample_rate").value()), 10.f)) << "kept from BEAM2";
+        expect(eq(std::get<float>(block.settings().get().at("scaling_factor")), 2.f));
+        expect(eq(std::get<float>(block.settings().get().at("sample_rate")), 10.f));
+
+        // contexts updated after the first switch are picked up by the next one
+        expect(block.settings().set({ { "scaling_factor", 4.f } }, beam1).empty());
+        block.settings().auto_update({ tag::CONTEXT(std::string("BEAM1")) });
+        std::ignore = block.settings().apply_staged_parameters();
+        expect(eq(block.scaling_factor.value, 4.f));
+        expect(eq(std::get<float>(block.settings().get("scaling_factor").value()), 4.f));
+    };
+
+    "context switches at tagged samples"_test = [] {
+        graph flow_graph;
+        auto  &src   = flow_graph.make_node<TagSource<float>>({ { "n_samples_max", 1000 } });
+        src.tags     = { { 100, { tag::CONTEXT(std::string("BEAM2")) } }, { 300, { tag::CONTEXT(std::string("BEAM1")) } } };
+        auto  &block = flow_graph.make_node<BatchedScale<float>>();
+        auto  &sink  = flow_graph.make_node<Sink<float>>();
+        expect(block.settings().set({ { "scaling_factor", 2.f } }, SettingsCtx{ .context = { tag::CONTEXT(std::string("BEAM1")) } }).empty());
+        expect(block.settings().set({ { "scaling_factor", 3.f } }, SettingsCtx{ .context = { tag::CONTEXT(std::string("BEAM2")) } }).empty());
+
+        expect(eq(connection_result_t::SUCCESS, flow_graph.connect<"out">(src).to<"in">(block)));
+        expect(eq(connection_result_t::SUCCESS, flow_graph.connect<"out">(block).to<"in">(sink)));
+
+        fair::graph::scheduler::simple sched{ std::move(flow_graph) };
+        sched.work();
+        expect(eq(sink.n_samples_consumed, 1000));
+        expect(eq(block.n_calls, 3UL));
+        expect(eq(block.scaling_factor, 2.f));
+        expect(eq(block.output_sum, 100.f * 1.f + 200.f * 3.f + 700.f * 2.f));
+    };
+
     "constructor"_test = [] {
         "empty"_test = [] {
             auto block  = TestBlock<float>();
@@ -313,6 +482,17 @@ const boost::ut::suite SettingsTests = [] {
         expect(eq(block.update_count, 1)) << fmt::format("actual update count: {}\n", block.update_count);
     };
 
+    "node-modified fields"_test = [] {
+        graph flow_graph;
+        auto &block          = flow_graph.make_node<TestBlock<float>>();
+        block.scaling_factor = 42.f; // e.g. modified by the node itself within 'process_bulk(..)'
+        expect(block.settings().set({ { "sample_rate", 2.f } }).empty());
+        std::ignore = block.settings().apply_staged_parameters();
+        expect(eq(std::get<float>(*block.settings().get("sample_rate")), 2.f));
+        expect(eq(std::get<float>(*block.settings().get("scaling_factor")), 42.f)) << "active settings are refreshed from all fields";
+        expect(eq(block.settings().get().size(), 5UL));
+    };
+
     "unique ID"_test = [] {
         graph flow_graph;
         auto &block1 = flow_graph.make_node<TestBlock<float>>();
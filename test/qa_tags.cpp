@@ -1,5 +1,6 @@
 #include <boost/ut.hpp>
 
+#include <flat_property_map.hpp>
 #include <tag.hpp>
 
 #if defined(__clang__) && __clang_major__ >= 16
@@ -20,6 +21,54 @@ const boost::ut::suite TagTests = [] {
         static_assert(refl::trait::get_t<1, refl::member_list<tag_t>>::name == "map", "class field map is public API");
     };
 
+    "CompactTag"_test = [] {
+        static_assert(sizeof(compact_tag_t) < sizeof(tag_t), "ring slots hold only the index and a payload handle");
+        compact_tag_t testTag;
+        expect(tag_map(testTag).empty());
+        expect(not testTag.get(tag::SAMPLE_RATE).has_value());
+
+        set_tag_map(testTag, property_map{ tag::SAMPLE_RATE(4.0f) });
+        expect(testTag.at(tag::SAMPLE_RATE) == 4.0f);
+        expect(testTag.get(tag::SAMPLE_RATE).has_value());
+
+        const compact_tag_t copy = testTag;
+        expect(copy.payload.get() == testTag.payload.get()) << "copies share the same payload";
+        expect(eq(testTag.payload.use_count(), 2L));
+    };
+
+    "FlatPropertyMap"_test = [] {
+        static_assert(default_tag_id<decltype(tag::SAMPLE_RATE)> == 0, "well-known keys have compile-time IDs");
+        static_assert(default_tag_id<decltype(tag::SAMPLE_RATE)> == default_tag_id<decltype(tag::SIGNAL_RATE)>, "aliases share the same ID");
+        static_assert(!DefaultTag<std::string>);
+        expect(eq(property_key_registry::instance().find(tag::TRIGGER_TIME.key()), default_tag_id<decltype(tag::TRIGGER_TIME)>));
+
+        flat_property_map map{ tag::SAMPLE_RATE(48'000.f), { "my_key", 42 } };
+        expect(eq(map.size(), std::size_t{ 2 }));
+        expect(map.at(tag::SAMPLE_RATE) == 48'000.f);
+        expect(map.at("my_key") == 42);
+        expect(not map.contains("unknown_key"));
+
+        map.insert_or_assign(tag::SAMPLE_RATE, 8'000.f);
+        map.insert_or_assign("a", 1);
+        map.insert_or_assign("b", 2);
+        map.insert_or_assign("c", 3); // exceeds the in-place storage
+        expect(eq(map.size(), std::size_t{ 5 }));
+        expect(map.at(tag::SAMPLE_RATE) == 8'000.f);
+        expect(std::is_sorted(map.begin(), map.end(), [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; }));
+
+        flat_property_map other{ tag::SAMPLE_RATE(1.f), { "d", 4 } };
+        map.insert(other);
+        expect(eq(map.size(), std::size_t{ 6 }));
+        expect(map.at(tag::SAMPLE_RATE) == 8'000.f) << "insert(..) does not overwrite existing keys";
+        expect(map.erase(default_tag_id<decltype(tag::SAMPLE_RATE)>));
+        expect(not map.contains(tag::SAMPLE_RATE));
+
+        const property_map legacy = map.to_property_map();
+        expect(eq(legacy.size(), map.size()));
+        expect(legacy.at("d") == 4);
+        expect(eq(flat_property_map(legacy).size(), map.size()));
+    };
+
     "DefaultTags"_test = [] {
         tag_t testTag;
 
@@ -42,6 +91,7 @@ const boost::ut::suite TagTests = [] {
         static_assert(tag::TRIGGER_NAME.shortKey() == "trigger_name");
         static_assert(tag::TRIGGER_TIME.shortKey() == "trigger_time");
         static_assert(tag::TRIGGER_OFFSET.shortKey() == "trigger_offset");
+        static_assert(tag::N_DROPPED.shortKey() == "n_dropped");
     };
 };
 